@@ -35,7 +35,7 @@
  **********/
 DEFINE_string(runtime_type, XFERBENCH_RT_ETCD, "Runtime type to use for communication [ETCD]");
 DEFINE_string(worker_type, XFERBENCH_WORKER_NIXL, "Type of worker [nixl, nvshmem]");
-DEFINE_string(backend, XFERBENCH_BACKEND_UCX, "Name of communication backend [UCX, UCX_MO, GDS, POSIX, GPUNETIO] \
+DEFINE_string(backend, XFERBENCH_BACKEND_UCX, "Name of communication backend [UCX, UCX_MO, GDS, POSIX, GPUNETIO, HF3FS, OBJ] \
               (only used with nixl worker)");
 DEFINE_string(initiator_seg_type, XFERBENCH_SEG_TYPE_DRAM, "Type of memory segment for initiator \
               [DRAM, VRAM]");
@@ -65,6 +65,14 @@ DEFINE_int32(num_initiator_dev, 1, "Number of device in initiator process");
 DEFINE_int32(num_target_dev, 1, "Number of device in target process");
 DEFINE_bool(enable_pt, false, "Enable Progress Thread (only used with nixl worker)");
 DEFINE_bool(enable_vmm, false, "Enable VMM memory allocation when DRAM is requested");
+DEFINE_uint64(pt_busy_poll_us, 0, "Time in us the progress thread keeps busy polling after \
+              activity (only used with enable_pt and UCX backends, 0 to always sleep)");
+DEFINE_int32(pt_cpu, -1, "CPU to pin the progress thread to (only used with enable_pt and \
+             UCX backends, -1 to not pin)");
+DEFINE_bool(ucx_mo_numa_aware, false, "Place DRAM buffers of each device on NUMA nodes round robin \
+            and route them to UCX engines of the same node (only used with UCX_MO backend)");
+DEFINE_int32(ucx_mo_post_threads, 0, "Number of threads posting to UCX engines in parallel \
+             (only used with UCX_MO backend, 0 to post from the calling thread)");
 
 // Storage backend(GDS, POSIX, HF3FS) options
 DEFINE_string (filepath, "", "File path for storage operations");
@@ -75,6 +83,18 @@ DEFINE_bool (storage_enable_direct, false, "Enable direct I/O for storage operat
 DEFINE_int32(gds_batch_pool_size, 32, "Batch pool size for GDS operations (default: 32, only used with GDS backend)");
 DEFINE_int32(gds_batch_limit, 128, "Batch limit for GDS operations (default: 128, only used with GDS backend)");
 
+// OBJ options - only used when backend is OBJ
+DEFINE_string (obj_local_dir,
+               "",
+               "Store the objects as files of this directory instead of S3 \
+               (only used with OBJ backend)");
+DEFINE_string (obj_bucket,
+               "",
+               "S3 bucket, AWS_DEFAULT_BUCKET when empty (only used with OBJ backend)");
+DEFINE_string (obj_endpoint_override,
+               "",
+               "S3 endpoint URL, e.g. http://localhost:9000 (only used with OBJ backend)");
+
 // TODO: We should take rank wise device list as input to extend support
 // <rank>:<device_list>, ...
 // For example- 0:mlx5_0,mlx5_1,mlx5_2,1:mlx5_3,mlx5_4, ...
@@ -85,7 +105,32 @@ DEFINE_string(etcd_endpoints, "http://localhost:2379", "ETCD server endpoints fo
 // POSIX options - only used when backend is POSIX
 DEFINE_string (posix_api_type,
                XFERBENCH_POSIX_API_AIO,
-               "API type for POSIX operations [AIO, URING] (only used with POSIX backend)");
+               "API type for POSIX operations [AIO, URING, LINUX_AIO, THREADPOOL] \
+               (only used with POSIX backend)");
+DEFINE_string (posix_uring_ring,
+               "shared",
+               "io_uring ring used by the requests [shared, per_thread, per_request] \
+               (only used with POSIX backend and URING API)");
+DEFINE_int32 (posix_uring_queue_depth,
+              256,
+              "Queue depth of shared and per thread io_uring rings \
+              (only used with POSIX backend and URING API)");
+DEFINE_bool (posix_uring_fixed,
+             true,
+             "Register buffers and files with the io_uring rings \
+             (only used with POSIX backend and URING API)");
+DEFINE_bool (posix_uring_sqpoll,
+             false,
+             "Poll the io_uring submission queue from a kernel thread \
+             (only used with POSIX backend and URING API)");
+DEFINE_bool (posix_uring_iopoll,
+             false,
+             "Busy-poll io_uring completions, needs --storage_enable_direct \
+             (only used with POSIX backend and URING API)");
+DEFINE_int32 (posix_thread_pool_size,
+              8,
+              "Number of threads running the I/Os of the engine \
+              (only used with POSIX backend and THREADPOOL API)");
 
 // DOCA GPUNetIO options - only used when backend is DOCA GPUNetIO
 DEFINE_string(gpunetio_device_list, "0", "Comma-separated GPU CUDA device id to use for \
@@ -112,14 +157,27 @@ int xferBenchConfig::warmup_iter = 0;
 int xferBenchConfig::num_threads = 0;
 bool xferBenchConfig::enable_pt = false;
 bool xferBenchConfig::enable_vmm = false;
+uint64_t xferBenchConfig::pt_busy_poll_us = 0;
+int xferBenchConfig::pt_cpu = -1;
+bool xferBenchConfig::ucx_mo_numa_aware = false;
+int xferBenchConfig::ucx_mo_post_threads = 0;
 std::string xferBenchConfig::device_list = "";
 std::string xferBenchConfig::etcd_endpoints = "";
 int xferBenchConfig::gds_batch_pool_size = 0;
 int xferBenchConfig::gds_batch_limit = 0;
+std::string xferBenchConfig::obj_local_dir = "";
+std::string xferBenchConfig::obj_bucket = "";
+std::string xferBenchConfig::obj_endpoint_override = "";
 std::string xferBenchConfig::gpunetio_device_list = "";
 std::vector<std::string> devices = { };
 int xferBenchConfig::num_files = 0;
 std::string xferBenchConfig::posix_api_type = "";
+std::string xferBenchConfig::posix_uring_ring = "";
+int xferBenchConfig::posix_uring_queue_depth = 0;
+bool xferBenchConfig::posix_uring_fixed = false;
+bool xferBenchConfig::posix_uring_sqpoll = false;
+bool xferBenchConfig::posix_uring_iopoll = false;
+int xferBenchConfig::posix_thread_pool_size = 0;
 std::string xferBenchConfig::filepath = "";
 bool xferBenchConfig::storage_enable_direct = false;
 
@@ -131,6 +189,10 @@ int xferBenchConfig::loadFromFlags() {
     if (worker_type == XFERBENCH_WORKER_NIXL) {
         backend = FLAGS_backend;
         enable_pt = FLAGS_enable_pt;
+        if (enable_pt) {
+            pt_busy_poll_us = FLAGS_pt_busy_poll_us;
+            pt_cpu = FLAGS_pt_cpu;
+        }
         device_list = FLAGS_device_list;
         enable_vmm = FLAGS_enable_vmm;
 
@@ -140,6 +202,12 @@ int xferBenchConfig::loadFromFlags() {
             return -1;
         }
 #endif
+        // Load UCX_MO-specific configurations if backend is UCX_MO
+        if (backend == XFERBENCH_BACKEND_UCX_MO) {
+            ucx_mo_numa_aware = FLAGS_ucx_mo_numa_aware;
+            ucx_mo_post_threads = FLAGS_ucx_mo_post_threads;
+        }
+
         // Load GDS-specific configurations if backend is GDS
         if (backend == XFERBENCH_BACKEND_GDS) {
             gds_batch_pool_size = FLAGS_gds_batch_pool_size;
@@ -154,11 +222,25 @@ int xferBenchConfig::loadFromFlags() {
 
             // Validate POSIX API type
             if (posix_api_type != XFERBENCH_POSIX_API_AIO &&
-                posix_api_type != XFERBENCH_POSIX_API_URING) {
+                posix_api_type != XFERBENCH_POSIX_API_URING &&
+                posix_api_type != XFERBENCH_POSIX_API_LINUX_AIO &&
+                posix_api_type != XFERBENCH_POSIX_API_THREADPOOL) {
                 std::cerr << "Invalid POSIX API type: " << posix_api_type
-                          << ". Must be one of [AIO, URING]" << std::endl;
+                          << ". Must be one of [AIO, URING, LINUX_AIO, THREADPOOL]" << std::endl;
                 return -1;
             }
+
+            if (posix_api_type == XFERBENCH_POSIX_API_THREADPOOL) {
+                posix_thread_pool_size = FLAGS_posix_thread_pool_size;
+            }
+
+            if (posix_api_type == XFERBENCH_POSIX_API_URING) {
+                posix_uring_ring = FLAGS_posix_uring_ring;
+                posix_uring_queue_depth = FLAGS_posix_uring_queue_depth;
+                posix_uring_fixed = FLAGS_posix_uring_fixed;
+                posix_uring_sqpoll = FLAGS_posix_uring_sqpoll;
+                posix_uring_iopoll = FLAGS_posix_uring_iopoll;
+            }
         }
 
         // Load DOCA-specific configurations if backend is DOCA
@@ -170,6 +252,20 @@ int xferBenchConfig::loadFromFlags() {
         if (backend == XFERBENCH_BACKEND_HF3FS) {
             storage_enable_direct = FLAGS_storage_enable_direct;
         }
+
+        // Load OBJ-specific configurations if backend is OBJ
+        if (backend == XFERBENCH_BACKEND_OBJ) {
+            obj_local_dir = FLAGS_obj_local_dir;
+            obj_bucket = FLAGS_obj_bucket;
+            obj_endpoint_override = FLAGS_obj_endpoint_override;
+
+            // Written objects can only be read back through the backend
+            if (FLAGS_check_consistency && FLAGS_op_type == XFERBENCH_OP_WRITE) {
+                std::cerr << "Consistency check of WRITE is not supported with OBJ backend"
+                          << std::endl;
+                return -1;
+            }
+        }
     }
 
     initiator_seg_type = FLAGS_initiator_seg_type;
@@ -280,11 +376,23 @@ void xferBenchConfig::printConfig() {
     }
     printOption ("Worker type (--worker_type=[nixl,nvshmem])", worker_type);
     if (worker_type == XFERBENCH_WORKER_NIXL) {
-        printOption ("Backend (--backend=[UCX,UCX_MO,GDS,POSIX])", backend);
+        printOption ("Backend (--backend=[UCX,UCX_MO,GDS,POSIX,HF3FS,OBJ])", backend);
         printOption ("Enable pt (--enable_pt=[0,1])", std::to_string (enable_pt));
+        if (enable_pt) {
+            printOption ("PT busy poll (--pt_busy_poll_us=N)", std::to_string (pt_busy_poll_us));
+            printOption ("PT CPU (--pt_cpu=N)", std::to_string (pt_cpu));
+        }
         printOption ("Device list (--device_list=dev1,dev2,...)", device_list);
         printOption ("Enable VMM (--enable_vmm=[0,1])", std::to_string (enable_vmm));
 
+        // Print UCX_MO options if backend is UCX_MO
+        if (backend == XFERBENCH_BACKEND_UCX_MO) {
+            printOption ("UCX_MO NUMA aware (--ucx_mo_numa_aware=[0,1])",
+                         std::to_string (ucx_mo_numa_aware));
+            printOption ("UCX_MO post threads (--ucx_mo_post_threads=N)",
+                         std::to_string (ucx_mo_post_threads));
+        }
+
         // Print GDS options if backend is GDS
         if (backend == XFERBENCH_BACKEND_GDS) {
             printOption ("GDS batch pool size (--gds_batch_pool_size=N)",
@@ -294,10 +402,33 @@ void xferBenchConfig::printConfig() {
 
         // Print POSIX options if backend is POSIX
         if (backend == XFERBENCH_BACKEND_POSIX) {
-            printOption ("POSIX API type (--posix_api_type=[AIO,URING])", posix_api_type);
+            printOption ("POSIX API type (--posix_api_type=[AIO,URING,LINUX_AIO,THREADPOOL])",
+                         posix_api_type);
+            if (posix_api_type == XFERBENCH_POSIX_API_THREADPOOL) {
+                printOption ("POSIX thread pool size (--posix_thread_pool_size=N)",
+                             std::to_string (posix_thread_pool_size));
+            }
+            if (posix_api_type == XFERBENCH_POSIX_API_URING) {
+                printOption ("POSIX io_uring ring (--posix_uring_ring=[shared,per_thread,per_request])",
+                             posix_uring_ring);
+                printOption ("POSIX io_uring queue depth (--posix_uring_queue_depth=N)",
+                             std::to_string (posix_uring_queue_depth));
+                printOption ("POSIX io_uring fixed (--posix_uring_fixed=[0,1])",
+                             std::to_string (posix_uring_fixed));
+                printOption ("POSIX io_uring SQPOLL (--posix_uring_sqpoll=[0,1])",
+                             std::to_string (posix_uring_sqpoll));
+                printOption ("POSIX io_uring IOPOLL (--posix_uring_iopoll=[0,1])",
+                             std::to_string (posix_uring_iopoll));
+            }
         }
 
-        if (xferBenchConfig::isStorageBackend()) {
+        // Print OBJ options if backend is OBJ
+        if (backend == XFERBENCH_BACKEND_OBJ) {
+            printOption ("OBJ local dir (--obj_local_dir=path)", obj_local_dir);
+            printOption ("OBJ bucket (--obj_bucket=name)", obj_bucket);
+            printOption ("OBJ endpoint override (--obj_endpoint_override=url)",
+                         obj_endpoint_override);
+        } else if (xferBenchConfig::isStorageBackend()) {
             printOption ("filepath (--filepath=path)", filepath);
             printOption ("Number of files (--num_files=N)", std::to_string (num_files));
             printOption ("Storage enable direct (--storage_enable_direct=[0,1])",
@@ -361,13 +492,17 @@ bool
 xferBenchConfig::isStorageBackend() {
     return (XFERBENCH_BACKEND_GDS == xferBenchConfig::backend ||
             XFERBENCH_BACKEND_HF3FS == xferBenchConfig::backend ||
-            XFERBENCH_BACKEND_POSIX == xferBenchConfig::backend);
+            XFERBENCH_BACKEND_POSIX == xferBenchConfig::backend ||
+            XFERBENCH_BACKEND_OBJ == xferBenchConfig::backend);
 }
 /**********
  * xferBench Utils
  **********/
 xferBenchRT *xferBenchUtils::rt = nullptr;
 std::string xferBenchUtils::dev_to_use = "";
+double xferBenchUtils::pt_p99_latency = 0;
+double xferBenchUtils::pt_cpu_util = 0;
+double xferBenchUtils::storage_cpu_time = 0;
 
 void xferBenchUtils::setRT(xferBenchRT *rt) {
     xferBenchUtils::rt = rt;
@@ -473,6 +608,15 @@ void xferBenchUtils::checkConsistency(std::vector<std::vector<xferBenchIOV>> &io
     }
 }
 
+void xferBenchUtils::setProgressStats(double p99_latency, double cpu_util) {
+    pt_p99_latency = p99_latency;
+    pt_cpu_util = cpu_util;
+}
+
+void xferBenchUtils::setStorageCpuTime(double cpu_time) {
+    storage_cpu_time = cpu_time;
+}
+
 void xferBenchUtils::printStatsHeader() {
     if (IS_PAIRWISE_AND_SG() && rt->getSize() > 2) {
         std::cout << std::left << std::setw(20) << "Block Size (B)"
@@ -482,17 +626,23 @@ void xferBenchUtils::printStatsHeader() {
                   << std::setw(15) << "B/W (GiB/Sec)"
                   << std::setw(15) << "B/W (GB/Sec)"
                   << std::setw(25) << "Aggregate B/W (GB/Sec)"
-                  << std::setw(20) << "Network Util (%)"
-                  << std::endl;
+                  << std::setw(20) << "Network Util (%)";
     } else {
         std::cout << std::left << std::setw(20) << "Block Size (B)"
                   << std::setw(15) << "Batch Size"
                   << std::setw(15) << "Avg Lat. (us)"
                   << std::setw(15) << "B/W (MiB/Sec)"
                   << std::setw(15) << "B/W (GiB/Sec)"
-                  << std::setw(15) << "B/W (GB/Sec)"
-                  << std::endl;
+                  << std::setw(15) << "B/W (GB/Sec)";
+    }
+    if (xferBenchConfig::enable_pt) {
+        std::cout << std::setw(15) << "P99 Lat. (us)"
+                  << std::setw(15) << "CPU Util (%)";
     }
+    if (xferBenchConfig::isStorageBackend()) {
+        std::cout << std::setw(15) << "CPU (s/GB)";
+    }
+    std::cout << std::endl;
     std::cout << std::string(80, '-') << std::endl;
 }
 
@@ -546,15 +696,22 @@ void xferBenchUtils::printStats(bool is_target, size_t block_size, size_t batch_
                   << std::setw(15) << throughput_gib
                   << std::setw(15) << throughput_gb
                   << std::setw(25) << totalbw
-                  << std::setw(20) << (totalbw / (rt->getSize()/2 * MAXBW))*100
-                  << std::endl;
+                  << std::setw(20) << (totalbw / (rt->getSize()/2 * MAXBW))*100;
     } else {
         std::cout << std::left << std::setw(20) << block_size
                   << std::setw(15) << batch_size
                   << std::setw(15) << avg_latency
                   << std::setw(15) << throughput
                   << std::setw(15) << throughput_gib
-                  << std::setw(15) << throughput_gb
-                  << std::endl;
+                  << std::setw(15) << throughput_gb;
+    }
+    if (xferBenchConfig::enable_pt) {
+        std::cout << std::setw(15) << pt_p99_latency
+                  << std::setw(15) << pt_cpu_util;
     }
+    if (xferBenchConfig::isStorageBackend()) {
+        std::cout << std::setw(15)
+                  << storage_cpu_time / ((double) total_data_transferred / 1e9);
+    }
+    std::cout << std::endl;
 }
@@ -71,10 +71,13 @@
 #define XFERBENCH_BACKEND_GPUNETIO "GPUNETIO"
 #define XFERBENCH_BACKEND_MOONCAKE "Mooncake"
 #define XFERBENCH_BACKEND_HF3FS "HF3FS"
+#define XFERBENCH_BACKEND_OBJ "OBJ"
 
 // POSIX API types
 #define XFERBENCH_POSIX_API_AIO "AIO"
 #define XFERBENCH_POSIX_API_URING "URING"
+#define XFERBENCH_POSIX_API_LINUX_AIO "LINUX_AIO"
+#define XFERBENCH_POSIX_API_THREADPOOL "THREADPOOL"
 
 // Scheme types for transfer patterns
 #define XFERBENCH_SCHEME_PAIRWISE     "pairwise"
@@ -124,15 +127,28 @@ class xferBenchConfig {
         static int warmup_iter;
         static int num_threads;
         static bool enable_pt;
+        static uint64_t pt_busy_poll_us;
+        static int pt_cpu;
+        static bool ucx_mo_numa_aware;
+        static int ucx_mo_post_threads;
         static std::string device_list;
         static std::string etcd_endpoints;
         static std::string filepath;
         static bool enable_vmm;
         static int num_files;
         static std::string posix_api_type;
+        static std::string posix_uring_ring;
+        static int posix_uring_queue_depth;
+        static bool posix_uring_fixed;
+        static bool posix_uring_sqpoll;
+        static bool posix_uring_iopoll;
+        static int posix_thread_pool_size;
         static bool storage_enable_direct;
         static int gds_batch_pool_size;
         static int gds_batch_limit;
+        static std::string obj_local_dir;
+        static std::string obj_bucket;
+        static std::string obj_endpoint_override;
         static std::string gpunetio_device_list;
 
         static int loadFromFlags();
@@ -164,12 +180,19 @@ class xferBenchUtils {
     private:
         static xferBenchRT *rt;
         static std::string dev_to_use;
+        // Completion latency and CPU usage of the last run with progress thread
+        static double pt_p99_latency;
+        static double pt_cpu_util;
+        // Process CPU time of the last storage run in seconds
+        static double storage_cpu_time;
     public:
         static void setRT(xferBenchRT *rt);
         static void setDevToUse(std::string dev);
         static std::string getDevToUse();
 
         static void checkConsistency(std::vector<std::vector<xferBenchIOV>> &desc_lists);
+        static void setProgressStats(double p99_latency, double cpu_util);
+        static void setStorageCpuTime(double cpu_time);
         static void printStatsHeader();
         static void printStats(bool is_target, size_t block_size, size_t batch_size,
 			                   double total_duration);
@@ -25,12 +25,16 @@
 #endif
 #include <fcntl.h>
 #include <filesystem>
+#include <fstream>
 #include <iomanip>
 #include <sstream>
 #include "utils/utils.h"
 #include <unistd.h>
 #include <utility>
 #include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <chrono>
 #include <utils/serdes/serdes.h>
 #include <omp.h>
 
@@ -116,22 +120,30 @@ xferBenchNixlWorker::xferBenchNixlWorker(int *argc, char ***argv, std::vector<st
         if (devices[0] != "all" && devices.size() >= 1) {
             if (isInitiator()) {
                 backend_params["device_list"] = devices[rank];
-                if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_UCX_MO)) {
-                    backend_params["num_ucx_engines"] = xferBenchConfig::num_initiator_dev;
-                }
             } else {
                 backend_params["device_list"] = devices[rank - xferBenchConfig::num_initiator_dev];
-                if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_UCX_MO)) {
-                    backend_params["num_ucx_engines"] = xferBenchConfig::num_target_dev;
-                }
             }
         }
 
+        if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_UCX_MO)) {
+            backend_params["num_ucx_engines"] = std::to_string(isInitiator() ?
+                                                               xferBenchConfig::num_initiator_dev :
+                                                               xferBenchConfig::num_target_dev);
+            backend_params["numa_aware"] = xferBenchConfig::ucx_mo_numa_aware ? "true" : "false";
+            backend_params["num_post_threads"] =
+                std::to_string(xferBenchConfig::ucx_mo_post_threads);
+        }
+
         if (gethostname(hostname, 256)) {
            std::cerr << "Failed to get hostname" << std::endl;
            exit(EXIT_FAILURE);
         }
 
+        if (enable_pt) {
+            backend_params["ucx_pt_busy_poll_us"] = std::to_string(xferBenchConfig::pt_busy_poll_us);
+            backend_params["ucx_pt_cpu"] = std::to_string(xferBenchConfig::pt_cpu);
+        }
+
         std::cout << "Init nixl worker, dev " << (("all" == devices[0]) ? "all" : backend_params["device_list"])
                   << " rank " << rank << ", type " << name << ", hostname "
                   << hostname << std::endl;
@@ -145,11 +157,27 @@ xferBenchNixlWorker::xferBenchNixlWorker(int *argc, char ***argv, std::vector<st
     } else if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_POSIX)) {
         // Set API type parameter for POSIX backend
         if (xferBenchConfig::posix_api_type == XFERBENCH_POSIX_API_AIO) {
-            backend_params["use_aio"] = true;
-            backend_params["use_uring"] = false;
+            backend_params["use_aio"] = "true";
+            backend_params["use_uring"] = "false";
+        } else if (xferBenchConfig::posix_api_type == XFERBENCH_POSIX_API_LINUX_AIO) {
+            backend_params["use_aio"] = "false";
+            backend_params["use_uring"] = "false";
+            backend_params["use_linux_aio"] = "true";
+        } else if (xferBenchConfig::posix_api_type == XFERBENCH_POSIX_API_THREADPOOL) {
+            backend_params["use_aio"] = "false";
+            backend_params["use_uring"] = "false";
+            backend_params["use_thread_pool"] = "true";
+            backend_params["thread_pool_size"] =
+                std::to_string(xferBenchConfig::posix_thread_pool_size);
         } else if (xferBenchConfig::posix_api_type == XFERBENCH_POSIX_API_URING) {
-            backend_params["use_aio"] = false;
-            backend_params["use_uring"] = true;
+            backend_params["use_aio"] = "false";
+            backend_params["use_uring"] = "true";
+            backend_params["uring_ring"] = xferBenchConfig::posix_uring_ring;
+            backend_params["uring_queue_depth"] =
+                std::to_string(xferBenchConfig::posix_uring_queue_depth);
+            backend_params["uring_fixed"] = xferBenchConfig::posix_uring_fixed ? "true" : "false";
+            backend_params["uring_sqpoll"] = xferBenchConfig::posix_uring_sqpoll ? "true" : "false";
+            backend_params["uring_iopoll"] = xferBenchConfig::posix_uring_iopoll ? "true" : "false";
         }
         std::cout << "POSIX backend with API type: " << xferBenchConfig::posix_api_type << std::endl;
     } else if (0 == xferBenchConfig::backend.compare(XFERBENCH_BACKEND_GPUNETIO)) {
@@ -161,6 +189,25 @@ xferBenchNixlWorker::xferBenchNixlWorker(int *argc, char ***argv, std::vector<st
     } else if (0 == xferBenchConfig::backend.compare (XFERBENCH_BACKEND_HF3FS)) {
         // Using default param values for HF3FS backend
         std::cout << "HF3FS backend" << std::endl;
+    } else if (0 == xferBenchConfig::backend.compare (XFERBENCH_BACKEND_OBJ)) {
+        if (!xferBenchConfig::obj_local_dir.empty()) {
+            backend_params["local_dir"] = xferBenchConfig::obj_local_dir;
+            std::cout << "OBJ backend, local dir " << xferBenchConfig::obj_local_dir << std::endl;
+        } else {
+            if (!xferBenchConfig::obj_bucket.empty()) {
+                backend_params["bucket"] = xferBenchConfig::obj_bucket;
+            }
+            if (!xferBenchConfig::obj_endpoint_override.empty()) {
+                backend_params["endpoint_override"] = xferBenchConfig::obj_endpoint_override;
+                if (xferBenchConfig::obj_endpoint_override.rfind ("http://", 0) == 0) {
+                    backend_params["scheme"] = "http";
+                }
+            }
+            std::cout << "OBJ backend, bucket "
+                      << (xferBenchConfig::obj_bucket.empty() ? "default" :
+                                                                xferBenchConfig::obj_bucket)
+                      << std::endl;
+        }
     } else {
         std::cerr << "Unsupported backend: " << xferBenchConfig::backend << std::endl;
         exit(EXIT_FAILURE);
@@ -209,10 +256,42 @@ static void iovListToNixlXferDlist(const std::vector<xferBenchIOV> &iov_list,
     }
 }
 
+// Bind the pages to a NUMA node before they're first touched, best effort
+static void bindDramToNumaNode(void *addr, size_t len, int dev_id) {
+#ifdef SYS_mbind
+    static const int mpol_bind = 2;
+    int num_nodes = 1;
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string nodes;
+
+    if (online >> nodes) {
+        num_nodes = std::stoi(nodes.substr(nodes.find_last_of(",-") + 1)) + 1;
+    }
+    if (num_nodes < 2) {
+        return;
+    }
+
+    unsigned long mask = 1UL << (dev_id % num_nodes);
+    if (syscall(SYS_mbind, addr, len, mpol_bind, &mask, sizeof(mask) * 8, 0)) {
+        std::cerr << "Failed to bind DRAM buffer to NUMA node " << (dev_id % num_nodes)
+                  << std::endl;
+    }
+#endif
+}
+
 std::optional<xferBenchIOV> xferBenchNixlWorker::initBasicDescDram(size_t buffer_size, int mem_dev_id) {
     void *addr;
 
-    addr = calloc(1, buffer_size);
+    if (xferBenchConfig::ucx_mo_numa_aware) {
+        // mbind needs a page aligned range
+        if (posix_memalign(&addr, sysconf(_SC_PAGESIZE), buffer_size)) {
+            addr = nullptr;
+        } else {
+            bindDramToNumaNode(addr, buffer_size, mem_dev_id);
+        }
+    } else {
+        addr = calloc(1, buffer_size);
+    }
     if (!addr) {
         std::cerr << "Failed to allocate " << buffer_size << " bytes of DRAM memory" << std::endl;
         return std::nullopt;
@@ -432,7 +511,10 @@ std::vector<std::vector<xferBenchIOV>> xferBenchNixlWorker::allocateMemory(int n
 
     opt_args.backends.push_back(backend_engine);
 
-    if (xferBenchConfig::isStorageBackend()) {
+    // Objects are registered when the transfer descriptors are known, see exchangeObjIOV
+    if (XFERBENCH_BACKEND_OBJ == xferBenchConfig::backend) {
+        remote_iovs.resize(num_lists);
+    } else if (xferBenchConfig::isStorageBackend()) {
         remote_fds = createFileFds (getName());
         if (remote_fds.empty()) {
             std::cerr << "Failed to create " << xferBenchConfig::backend << " file" << std::endl;
@@ -518,7 +600,14 @@ void xferBenchNixlWorker::deallocateMemory(std::vector<std::vector<xferBenchIOV>
                          "deregisterMem failed");
     }
 
-    if (xferBenchConfig::isStorageBackend()) {
+    if (XFERBENCH_BACKEND_OBJ == xferBenchConfig::backend) {
+        for (auto &iov_list: remote_iovs) {
+            nixl_reg_dlist_t desc_list(OBJ_SEG);
+            iovListToNixlRegDlist(iov_list, desc_list);
+            CHECK_NIXL_ERROR(agent->deregisterMem(desc_list, &opt_args),
+                             "deregisterMem failed");
+        }
+    } else if (xferBenchConfig::isStorageBackend()) {
         for (auto &iov_list: remote_iovs) {
             for (auto &iov: iov_list) {
                 cleanupBasicDescFile(iov);
@@ -588,7 +677,9 @@ xferBenchNixlWorker::exchangeIOV(const std::vector<std::vector<xferBenchIOV>> &l
     std::vector<std::vector<xferBenchIOV>> res;
     int desc_str_sz;
 
-    if (xferBenchConfig::isStorageBackend()) {
+    if (XFERBENCH_BACKEND_OBJ == xferBenchConfig::backend) {
+        res = exchangeObjIOV(local_iovs);
+    } else if (xferBenchConfig::isStorageBackend()) {
         for (auto &iov_list: local_iovs) {
             std::vector<xferBenchIOV> remote_iov_list;
             for (auto &iov: iov_list) {
@@ -653,12 +744,107 @@ xferBenchNixlWorker::exchangeIOV(const std::vector<std::vector<xferBenchIOV>> &l
     return res;
 }
 
+// Every transfer descriptor gets its own object, registered on first use with
+// the largest block size and reused by the following block sizes
+std::vector<std::vector<xferBenchIOV>>
+xferBenchNixlWorker::exchangeObjIOV(const std::vector<std::vector<xferBenchIOV>> &local_iovs) {
+    std::vector<std::vector<xferBenchIOV>> res;
+    nixl_opt_args_t opt_args;
+
+    opt_args.backends.push_back(backend_engine);
+
+    for (size_t list_idx = 0; list_idx < local_iovs.size(); list_idx++) {
+        const auto &iov_list = local_iovs[list_idx];
+        auto &obj_list = remote_iovs[list_idx];
+        std::vector<xferBenchIOV> remote_iov_list;
+
+        if (obj_list.size() < iov_list.size()) {
+            nixl_reg_dlist_t desc_list(OBJ_SEG);
+            while (obj_list.size() < iov_list.size()) {
+                nixlBlobDesc desc(0, xferBenchConfig::max_block_size, obj_next_dev_id++,
+                                  "nixlbench_obj_" + getName() + "_" +
+                                  std::to_string(list_idx) + "_" +
+                                  std::to_string(obj_list.size()));
+                desc_list.addDesc(desc);
+                obj_list.emplace_back(desc.addr, desc.len, desc.devId);
+            }
+            CHECK_NIXL_ERROR(agent->registerMem(desc_list, &opt_args),
+                             "registerMem failed");
+        }
+
+        for (size_t i = 0; i < iov_list.size(); i++) {
+            remote_iov_list.emplace_back(0, iov_list[i].len, obj_list[i].devId);
+        }
+        res.push_back(remote_iov_list);
+    }
+
+    // Reads need the objects to exist, with the content the consistency check expects
+    if (XFERBENCH_OP_READ == xferBenchConfig::op_type) {
+        fillObjects(res);
+    }
+
+    return res;
+}
+
+void xferBenchNixlWorker::fillObjects(const std::vector<std::vector<xferBenchIOV>> &obj_iov_lists) {
+    size_t max_len = 0;
+    nixl_opt_args_t opt_args;
+    nixlXferReqH *req;
+    nixl_status_t rc;
+
+    for (const auto &iov_list: obj_iov_lists) {
+        for (const auto &iov: iov_list) {
+            max_len = std::max(max_len, iov.len);
+        }
+    }
+    if (0 == max_len) {
+        return;
+    }
+
+    // Objects are always initialized with XFERBENCH_TARGET_BUFFER_ELEMENT
+    void *buf = malloc(max_len);
+    if (!buf) {
+        std::cerr << "Failed to allocate " << max_len << " bytes of memory" << std::endl;
+        exit(EXIT_FAILURE);
+    }
+    memset(buf, XFERBENCH_TARGET_BUFFER_ELEMENT, max_len);
+
+    opt_args.backends.push_back(backend_engine);
+    std::vector<xferBenchIOV> buf_iov = {xferBenchIOV((uintptr_t)buf, max_len, 0)};
+    nixl_reg_dlist_t buf_reg(DRAM_SEG);
+    iovListToNixlRegDlist(buf_iov, buf_reg);
+    CHECK_NIXL_ERROR(agent->registerMem(buf_reg, &opt_args), "registerMem failed");
+
+    for (const auto &iov_list: obj_iov_lists) {
+        nixl_xfer_dlist_t local_desc(DRAM_SEG);
+        nixl_xfer_dlist_t remote_desc(OBJ_SEG);
+
+        for (const auto &iov: iov_list) {
+            local_desc.addDesc(nixlBasicDesc((uintptr_t)buf, iov.len, 0));
+            remote_desc.addDesc(nixlBasicDesc(iov.addr, iov.len, iov.devId));
+        }
+
+        CHECK_NIXL_ERROR(agent->createXferReq(NIXL_WRITE, local_desc, remote_desc, getName(),
+                                              req, &opt_args), "createTransferReq failed");
+        rc = agent->postXferReq(req);
+        while (NIXL_IN_PROG == rc) {
+            rc = agent->getXferStatus(req);
+        }
+        CHECK_NIXL_ERROR(rc, "Failed to fill objects");
+        agent->releaseXferReq(req);
+    }
+
+    CHECK_NIXL_ERROR(agent->deregisterMem(buf_reg, &opt_args), "deregisterMem failed");
+    free(buf);
+}
+
 static int execTransfer(nixlAgent *agent,
                         const std::vector<std::vector<xferBenchIOV>> &local_iovs,
                         const std::vector<std::vector<xferBenchIOV>> &remote_iovs,
                         const nixl_xfer_op_t op,
                         const int num_iter,
-                        const int num_threads)
+                        const int num_threads,
+                        std::vector<double> *latencies = nullptr)
 {
     int ret = 0;
 
@@ -672,7 +858,9 @@ static int execTransfer(nixlAgent *agent,
         nixl_xfer_dlist_t local_desc(GET_SEG_TYPE(true));
         nixl_xfer_dlist_t remote_desc(GET_SEG_TYPE(false));
 
-        if (xferBenchConfig::isStorageBackend()) {
+        if (XFERBENCH_BACKEND_OBJ == xferBenchConfig::backend) {
+            remote_desc = nixl_xfer_dlist_t(OBJ_SEG);
+        } else if (xferBenchConfig::isStorageBackend()) {
             remote_desc = nixl_xfer_dlist_t(FILE_SEG);
         }
 
@@ -700,7 +888,13 @@ static int execTransfer(nixlAgent *agent,
         CHECK_NIXL_ERROR(agent->createXferReq(op, local_desc, remote_desc, target,
                                             req, &params), "createTransferReq failed");
 
+        std::vector<double> thread_latencies;
+        if (latencies) {
+            thread_latencies.reserve(num_iter);
+        }
+
         for (int i = 0; i < num_iter && !error; i++) {
+            auto start = std::chrono::steady_clock::now();
             rc = agent->postXferReq(req);
             if (NIXL_ERR_BACKEND == rc) {
                 std::cout << "NIXL postRequest failed" << std::endl;
@@ -716,6 +910,16 @@ static int execTransfer(nixlAgent *agent,
                     }
                 } while (NIXL_SUCCESS != rc);
             }
+
+            if (latencies) {
+                thread_latencies.push_back(std::chrono::duration<double, std::micro>(
+                                           std::chrono::steady_clock::now() - start).count());
+            }
+        }
+
+        if (latencies) {
+            #pragma omp critical
+            latencies->insert(latencies->end(), thread_latencies.begin(), thread_latencies.end());
         }
 
         agent->releaseXferReq(req);
@@ -753,14 +957,39 @@ std::variant<double, int> xferBenchNixlWorker::transfer(size_t block_size,
     // Synchronize to ensure all processes have completed the warmup (iter and polling)
     synchronize();
 
+    // With progress thread, also track completion latency and CPU usage of the
+    // whole process, which includes the progress thread spinning or sleeping
+    std::vector<double> latencies;
+    struct rusage ru_start, ru_end;
+    getrusage(RUSAGE_SELF, &ru_start);
+
     gettimeofday(&t_start, nullptr);
 
-    ret = execTransfer(agent, local_iovs, remote_iovs, xfer_op, num_iter, xferBenchConfig::num_threads);
+    ret = execTransfer(agent, local_iovs, remote_iovs, xfer_op, num_iter, xferBenchConfig::num_threads,
+                       xferBenchConfig::enable_pt ? &latencies : nullptr);
 
     gettimeofday(&t_end, nullptr);
     total_duration += (((t_end.tv_sec - t_start.tv_sec) * 1e6) +
                        (t_end.tv_usec - t_start.tv_usec)); // In us
 
+    getrusage(RUSAGE_SELF, &ru_end);
+    double cpu_time = (((ru_end.ru_utime.tv_sec - ru_start.ru_utime.tv_sec) +
+                        (ru_end.ru_stime.tv_sec - ru_start.ru_stime.tv_sec)) * 1e6) +
+                      (ru_end.ru_utime.tv_usec - ru_start.ru_utime.tv_usec) +
+                      (ru_end.ru_stime.tv_usec - ru_start.ru_stime.tv_usec); // In us
+
+    // Storage backends report CPU cost per GB, which includes the kernel
+    // time spent submitting and completing the I/Os
+    if (xferBenchConfig::isStorageBackend()) {
+        xferBenchUtils::setStorageCpuTime(cpu_time / 1e6);
+    }
+
+    if (xferBenchConfig::enable_pt && !latencies.empty()) {
+        size_t p99_idx = (latencies.size() * 99) / 100;
+        std::nth_element(latencies.begin(), latencies.begin() + p99_idx, latencies.end());
+        xferBenchUtils::setProgressStats(latencies[p99_idx], (cpu_time / total_duration) * 100);
+    }
+
     synchronize();
     return ret < 0 ? std::variant<double, int>(ret) : std::variant<double, int>(total_duration);
 }
@@ -36,6 +36,7 @@ class xferBenchNixlWorker: public xferBenchWorker {
         nixl_mem_t seg_type;
         std::vector<int> remote_fds;
         std::vector<std::vector<xferBenchIOV>> remote_iovs;
+        int obj_next_dev_id = 0;
     public:
         xferBenchNixlWorker(int *argc, char ***argv, std::vector<std::string> devices);
         ~xferBenchNixlWorker();  // Custom destructor to clean up resources
@@ -65,6 +66,9 @@ class xferBenchNixlWorker: public xferBenchWorker {
 #endif
         std::optional<xferBenchIOV> initBasicDescFile(size_t buffer_size, int fd, int mem_dev_id);
         void cleanupBasicDescFile(xferBenchIOV &basic_desc);
+        std::vector<std::vector<xferBenchIOV>>
+        exchangeObjIOV(const std::vector<std::vector<xferBenchIOV>> &local_iov_lists);
+        void fillObjects(const std::vector<std::vector<xferBenchIOV>> &obj_iov_lists);
 };
 
 #endif // __NIXL_WORKER_H
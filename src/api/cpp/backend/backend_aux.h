@@ -28,16 +28,6 @@
 typedef std::vector<std::pair<std::string, std::string>> notif_list_t;
 
 
-struct nixlBackendOptionalArgs {
-    // During postXfer, user might ask for a notification if supported
-    nixl_blob_t notifMsg;
-    bool        hasNotif = false;
-    nixl_blob_t customParam;
-};
-
-using nixl_opt_b_args_t = nixlBackendOptionalArgs;
-
-
 // A base class to point to backend initialization data
 // User doesn't know about fields such as local_agent but can access it
 // after the backend is initialized by agent. If we needed to make it private
@@ -112,4 +102,30 @@ class nixlMetaDesc : public nixlBasicDesc {
 
 typedef nixlDescList<nixlMetaDesc> nixl_meta_dlist_t;
 
+struct nixlBackendOptionalArgs {
+    // During postXfer, user might ask for a notification if supported
+    nixl_blob_t  notifMsg;
+    bool         hasNotif = false;
+    nixl_blob_t  customParam;
+    // During postXfer, user might ask for a remote counter increment if supported
+    nixlMetaDesc remoteCounter;
+    bool         hasRemoteCounter = false;
+};
+
+using nixl_opt_b_args_t = nixlBackendOptionalArgs;
+
+// A single request within a group posted together through postXferBatch.
+// Backend writes the post result of each request to status.
+struct nixlBackendXferBatchElem {
+    nixl_xfer_op_t           operation;
+    const nixl_meta_dlist_t* local;
+    const nixl_meta_dlist_t* remote;
+    const std::string*       remoteAgent;
+    nixlBackendReqH*         handle;
+    nixl_opt_b_args_t        optArgs;
+    nixl_status_t            status = NIXL_ERR_NOT_POSTED;
+};
+
+using nixl_b_batch_t = std::vector<nixlBackendXferBatchElem>;
+
 #endif
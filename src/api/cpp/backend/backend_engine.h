@@ -86,6 +86,13 @@ class nixlBackendEngine {
         // Determines if a backend supports progress thread.
         virtual bool supportsProgTh() const = 0;
 
+        // Determines if a backend supports incrementing a remote counter on completion.
+        virtual bool supportsRemoteCounter() const { return false; }
+
+        // Determines if registerMem, loadLocalMD and getPublicData can be called concurrently
+        // from several threads for different descriptors, to speed up large registrations.
+        virtual bool supportsParallelReg() const { return false; }
+
         virtual nixl_mem_list_t getSupportedMems() const = 0;  // TODO: Return by const-reference and mark noexcept?
 
 
@@ -138,6 +145,25 @@ class nixlBackendEngine {
                                         const nixl_opt_b_args_t* opt_args=nullptr
                                        ) const = 0;
 
+        // Posting a group of prepared requests together. Backends that can amortize per request
+        // costs across the group (e.g., a single flush per endpoint) should override this, the
+        // default posts them one by one. Returns the first error, or NIXL_IN_PROG if any of the
+        // requests is still in progress. Result of each request is set in its status field.
+        virtual nixl_status_t postXferBatch(nixl_b_batch_t &batch) const {
+            nixl_status_t ret = NIXL_SUCCESS;
+            for (auto &elm : batch) {
+                elm.status = postXfer(elm.operation, *elm.local, *elm.remote,
+                                      *elm.remoteAgent, elm.handle, &elm.optArgs);
+                if (elm.status < 0) {
+                    if (ret >= 0)
+                        ret = elm.status;
+                } else if ((elm.status == NIXL_IN_PROG) && (ret == NIXL_SUCCESS)) {
+                    ret = NIXL_IN_PROG;
+                }
+            }
+            return ret;
+        }
+
         // Use a handle to progress backend engine and see if a transfer is completed or not
         virtual nixl_status_t checkXfer(nixlBackendReqH* handle) const = 0;
 
@@ -265,6 +265,24 @@ class nixlAgent {
         postXferReq (nixlXferReqH* req_hndl,
                      const nixl_opt_args_t* extra_params = nullptr) const;
 
+        /**
+         * @brief  Submit a group of transfer requests together. Requests are grouped per
+         *         backend, so a backend can amortize per request costs across the group,
+         *         e.g., UCX issues a single flush per endpoint for all of them. Each request
+         *         uses the notification it was created or last posted with, and its status
+         *         can be checked with getXferStatus same as after postXferReq. None of the
+         *         requests are posted if any of them is invalid, listed more than once or
+         *         still in progress.
+         *
+         * @param  req_hndls     Transfer request handles obtained from makeXferReq/createXferReq
+         * @return nixl_status_t NIXL_SUCCESS if all requests completed, NIXL_IN_PROG if any is
+         *                       in progress, NIXL_ERR_INVALID_PARAM if a request is listed more
+         *                       than once or still in progress, or the first error code if any
+         *                       post failed
+         */
+        nixl_status_t
+        postXferReqs (const std::vector<nixlXferReqH*> &req_hndls) const;
+
         /**
          * @brief  Check the status of transfer request `req_hndl`
          *
@@ -52,6 +52,19 @@ class nixlAgentConfig {
          *      These will be combined into a unified NIXL Thread API in a future version.
          */
         uint64_t lthrDelay;
+        /**
+         * @var Number of threads registering the descriptors of a registerMem call, for
+         *      backends that support parallel registration. 0 or 1 registers them on the
+         *      calling thread. Useful when registration pins a large amount of memory.
+         */
+        unsigned int regThreads;
+        /**
+         * @var Coalesce contiguous or overlapping DRAM descriptors of a registerMem call into
+         *      a single backend registration. The descriptors remain valid for transfers,
+         *      partial metadata and deregistration, and the span is deregistered along with
+         *      its last descriptor. Reduces the number of memory keys and the metadata size.
+         */
+        bool regCoalesce;
 
 
         /**
@@ -75,7 +88,9 @@ class nixlAgentConfig {
                          listenPort(port),
                          syncMode(sync_mode),
                          pthrDelay(pthr_delay_us),
-                         lthrDelay(lthr_delay_us) { }
+                         lthrDelay(lthr_delay_us),
+                         regThreads(0),
+                         regCoalesce(false) { }
 
         /**
          * @brief Copy constructor for nixlAgentConfig object
@@ -142,6 +142,8 @@ extern const std::string default_partial_metadata_label;
  */
 enum class nixl_cost_t {
     ANALYTICAL_BACKEND = 0, // Analytical backend cost estimate
+    // 1 is left out, the Rust binding reports it as unknown
+    CALIBRATED_BACKEND = 2, // Backend cost estimate calibrated by observed transfers
 };
 
 /**
@@ -168,6 +170,31 @@ struct nixlAgentOptionalArgs {
      */
     bool hasNotif = false;
 
+    /**
+     * @var remoteCounterAddr Address of a 64-bit counter within remote agent's registered memory.
+     *      After the data of the transfer is delivered, the initiator atomically increments it
+     *      by one, so the target can poll its local memory for completion instead of getting
+     *      notifications. Used in createXferReq / makeXferReq / postXferReq.
+     */
+    uintptr_t remoteCounterAddr = 0;
+
+    /**
+     * @var remoteCounterDevId Device ID of the remote counter memory.
+     */
+    uint64_t remoteCounterDevId = 0;
+
+    /**
+     * @var remoteCounterMem Memory type of the remote counter, should be registered in the
+     *      remote agent with the backend selected for the transfer.
+     */
+    nixl_mem_t remoteCounterMem = DRAM_SEG;
+
+    /**
+     * @var hasRemoteCounter boolean value to indicate that a remote counter is provided, or to
+     *      remove it during a repost. If set to false, remoteCounter fields are not checked.
+     */
+    bool hasRemoteCounter = false;
+
     /**
      * @var makeXferReq boolean to skip merging consecutive descriptors, used in makeXferReq.
      */
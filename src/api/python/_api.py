@@ -356,6 +356,8 @@ class nixl_agent:
         duration, err_margin, method = self.agent.estimateXferCost(req_handle)
         if method == nixlBind.NIXL_COST_ANALYTICAL_BACKEND:
             method = "ANALYTICAL_BACKEND"
+        elif method == nixlBind.NIXL_COST_CALIBRATED_BACKEND:
+            method = "CALIBRATED_BACKEND"
         else:
             method = "UNKNOWN"
         return duration, err_margin, method
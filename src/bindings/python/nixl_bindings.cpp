@@ -145,6 +145,7 @@ PYBIND11_MODULE(_bindings, m) {
 
     py::enum_<nixl_cost_t>(m, "nixl_cost_t")
         .value("NIXL_COST_ANALYTICAL_BACKEND", nixl_cost_t::ANALYTICAL_BACKEND)
+        .value("NIXL_COST_CALIBRATED_BACKEND", nixl_cost_t::CALIBRATED_BACKEND)
         .export_values();
 
     py::enum_<nixl_status_t>(m, "nixl_status_t")
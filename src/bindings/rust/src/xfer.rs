@@ -28,12 +28,14 @@ pub enum XferOp {
 pub enum CostMethod {
     AnalyticalBackend = 0,
     Unknown = 1,
+    CalibratedBackend = 2,
 }
 
 impl From<u32> for CostMethod {
     fn from(value: u32) -> Self {
         match value {
             0 => CostMethod::AnalyticalBackend,
+            2 => CostMethod::CalibratedBackend,
             _ => CostMethod::Unknown,
         }
     }
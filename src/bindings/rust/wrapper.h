@@ -190,6 +190,7 @@ nixl_capi_status_t nixl_capi_create_xfer_req(
 
 typedef enum {
   NIXL_CAPI_COST_ANALYTICAL_BACKEND = 0,
+  NIXL_CAPI_COST_CALIBRATED_BACKEND = 2,
 } nixl_capi_cost_t;
 
 nixl_capi_status_t nixl_capi_estimate_xfer_cost(
@@ -16,6 +16,7 @@
  */
 
 #include <iostream>
+#include <unordered_set>
 #include "nixl.h"
 #include "serdes/serdes.h"
 #include "backend/backend_engine.h"
@@ -76,7 +77,7 @@ nixlAgentData::nixlAgentData(const std::string &name,
     if (name.empty())
         throw std::invalid_argument("Agent needs a name");
 
-    memorySection = new nixlLocalSection();
+    memorySection = new nixlLocalSection(cfg.regCoalesce);
 }
 
 nixlAgentData::~nixlAgentData() {
@@ -306,9 +307,11 @@ nixlAgent::registerMem(const nixl_reg_dlist_t &descs,
         nixlBackendEngine* backend = (*backend_list)[i];
         // meta_descs use to be passed to loadLocalData
         nixl_sec_dlist_t sec_descs(descs.getType(), false);
-        ret = data->memorySection->addDescList(descs, backend, sec_descs);
+        ret = data->memorySection->addDescList(descs, backend, sec_descs,
+                                               data->config.regThreads);
         if (ret == NIXL_SUCCESS) {
-            if (backend->supportsLocal()) {
+            // Coalesced descriptors might all be covered by existing registrations
+            if (backend->supportsLocal() && !sec_descs.isEmpty()) {
                 if (data->remoteSections.count(data->name) == 0)
                     data->remoteSections[data->name] =
                           new nixlRemoteSection(data->name);
@@ -483,6 +486,33 @@ nixlAgent::prepXferDlist (const std::string &agent_name,
     }
 }
 
+// Finds the backend metadata of the remote counter provided in extra_params
+static nixl_status_t
+populateRemoteCounter(const nixl_opt_args_t* extra_params,
+                      const nixlRemoteSection* remote_section,
+                      nixlBackendEngine* backend,
+                      nixl_opt_b_args_t &opt_args) {
+    if (!backend->supportsRemoteCounter())
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    // Atomic operations require natural alignment
+    if (extra_params->remoteCounterAddr % sizeof(uint64_t) != 0)
+        return NIXL_ERR_INVALID_PARAM;
+
+    nixl_xfer_dlist_t query(extra_params->remoteCounterMem);
+    nixl_meta_dlist_t resp(extra_params->remoteCounterMem);
+    query.addDesc(nixlBasicDesc(extra_params->remoteCounterAddr, sizeof(uint64_t),
+                                extra_params->remoteCounterDevId));
+
+    nixl_status_t ret = remote_section->populate(query, backend, resp);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    opt_args.remoteCounter    = resp[0];
+    opt_args.hasRemoteCounter = true;
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t
 nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
                         const nixlDlistH* local_side,
@@ -564,6 +594,14 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
         return NIXL_ERR_BACKEND;
     }
 
+    if (extra_params && extra_params->hasRemoteCounter) {
+        ret = populateRemoteCounter(extra_params,
+                                    data->remoteSections[remote_side->remoteAgent],
+                                    backend, opt_args);
+        if (ret != NIXL_SUCCESS)
+            return ret;
+    }
+
     // Populate has been already done, no benefit in having sorted descriptors
     // which will be overwritten by [] assignment operator.
     nixlXferReqH* handle   = new nixlXferReqH;
@@ -624,6 +662,8 @@ nixlAgent::makeXferReq (const nixl_xfer_op_t &operation,
     handle->remoteAgent = remote_side->remoteAgent;
     handle->notifMsg    = opt_args.notifMsg;
     handle->hasNotif    = opt_args.hasNotif;
+    handle->remoteCounter    = opt_args.remoteCounter;
+    handle->hasRemoteCounter = opt_args.hasRemoteCounter;
     handle->backendOp   = operation;
     handle->status      = NIXL_ERR_NOT_POSTED;
 
@@ -746,11 +786,22 @@ nixlAgent::createXferReq(const nixl_xfer_op_t &operation,
         return NIXL_ERR_BACKEND;
     }
 
+    if (extra_params && extra_params->hasRemoteCounter) {
+        ret1 = populateRemoteCounter(extra_params, data->remoteSections[remote_agent],
+                                     handle->engine, opt_args);
+        if (ret1 != NIXL_SUCCESS) {
+            delete handle;
+            return ret1;
+        }
+    }
+
     handle->remoteAgent = remote_agent;
     handle->backendOp   = operation;
     handle->status      = NIXL_ERR_NOT_POSTED;
     handle->notifMsg    = opt_args.notifMsg;
     handle->hasNotif    = opt_args.hasNotif;
+    handle->remoteCounter    = opt_args.remoteCounter;
+    handle->hasRemoteCounter = opt_args.hasRemoteCounter;
 
     ret1 = handle->engine->prepXfer (handle->backendOp,
                                      *handle->initiatorDescs,
@@ -834,7 +885,12 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
         opt_args.hasNotif = true;
     }
 
-    // Updating the notification based on opt_args
+    if (req_hndl->hasRemoteCounter) {
+        opt_args.remoteCounter    = req_hndl->remoteCounter;
+        opt_args.hasRemoteCounter = true;
+    }
+
+    // Updating the notification and remote counter based on opt_args
     if (extra_params) {
         if (extra_params->hasNotif) {
             req_hndl->notifMsg = extra_params->notifMsg;
@@ -845,6 +901,21 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
             req_hndl->hasNotif = false;
             opt_args.hasNotif  = false;
         }
+
+        if (extra_params->hasRemoteCounter) {
+            ret = populateRemoteCounter(extra_params,
+                                        data->remoteSections[req_hndl->remoteAgent],
+                                        req_hndl->engine, opt_args);
+            if (ret != NIXL_SUCCESS) {
+                delete req_hndl;
+                return ret;
+            }
+            req_hndl->remoteCounter    = opt_args.remoteCounter;
+            req_hndl->hasRemoteCounter = true;
+        } else {
+            req_hndl->hasRemoteCounter = false;
+            opt_args.hasRemoteCounter  = false;
+        }
     }
 
     if (opt_args.hasNotif && (!req_hndl->engine->supportsNotif())) {
@@ -863,6 +934,76 @@ nixlAgent::postXferReq(nixlXferReqH *req_hndl,
     return ret;
 }
 
+nixl_status_t
+nixlAgent::postXferReqs(const std::vector<nixlXferReqH*> &req_hndls) const {
+    std::unordered_map<nixlBackendEngine*, nixl_b_batch_t> batches;
+    std::unordered_map<nixlBackendEngine*, std::vector<nixlXferReqH*>> batch_reqs;
+    std::unordered_set<nixlXferReqH*> seen;
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    if (req_hndls.empty())
+        return NIXL_ERR_INVALID_PARAM;
+
+    NIXL_SHARED_LOCK_GUARD(data->lock);
+    // Validate the whole group first, so either all or none are posted
+    for (auto &req_hndl : req_hndls) {
+        // A request listed twice would be reposted while active
+        if (!req_hndl || !seen.insert(req_hndl).second)
+            return NIXL_ERR_INVALID_PARAM;
+
+        if (data->remoteSections.count(req_hndl->remoteAgent) == 0)
+            return NIXL_ERR_NOT_FOUND;
+
+        if (req_hndl->status == NIXL_IN_PROG) {
+            req_hndl->status = req_hndl->engine->checkXfer(
+                                         req_hndl->backendHandle);
+            if (req_hndl->status == NIXL_IN_PROG)
+                return NIXL_ERR_INVALID_PARAM;
+        }
+
+        if (req_hndl->hasNotif && (!req_hndl->engine->supportsNotif()))
+            return NIXL_ERR_BACKEND;
+    }
+
+    for (auto &req_hndl : req_hndls) {
+        nixlBackendXferBatchElem elm;
+        elm.operation           = req_hndl->backendOp;
+        elm.local               = req_hndl->initiatorDescs;
+        elm.remote              = req_hndl->targetDescs;
+        elm.remoteAgent         = &req_hndl->remoteAgent;
+        elm.handle              = req_hndl->backendHandle;
+        elm.optArgs.hasNotif    = req_hndl->hasNotif;
+        if (req_hndl->hasNotif)
+            elm.optArgs.notifMsg = req_hndl->notifMsg;
+        elm.optArgs.hasRemoteCounter = req_hndl->hasRemoteCounter;
+        if (req_hndl->hasRemoteCounter)
+            elm.optArgs.remoteCounter = req_hndl->remoteCounter;
+
+        batches[req_hndl->engine].push_back(std::move(elm));
+        batch_reqs[req_hndl->engine].push_back(req_hndl);
+    }
+
+    for (auto & [engine, batch] : batches) {
+        nixl_status_t batch_ret = engine->postXferBatch(batch);
+
+        auto &reqs = batch_reqs[engine];
+        for (size_t i = 0; i < batch.size(); ++i) {
+            // Backend might have replaced the handle, same as in postXfer
+            reqs[i]->backendHandle = batch[i].handle;
+            reqs[i]->status        = batch[i].status;
+        }
+
+        if (batch_ret < 0) {
+            if (ret >= 0)
+                ret = batch_ret;
+        } else if ((batch_ret == NIXL_IN_PROG) && (ret == NIXL_SUCCESS)) {
+            ret = NIXL_IN_PROG;
+        }
+    }
+
+    return ret;
+}
+
 nixl_status_t
 nixlAgent::getXferStatus (nixlXferReqH *req_hndl) const {
 
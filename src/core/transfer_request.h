@@ -30,6 +30,8 @@ class nixlXferReqH {
         std::string        remoteAgent;
         nixl_blob_t        notifMsg;
         bool               hasNotif       = false;
+        nixlMetaDesc       remoteCounter;
+        bool               hasRemoteCounter = false;
 
         nixl_xfer_op_t     backendOp;
         nixl_status_t      status;
@@ -66,6 +66,9 @@ class nixlMemSection {
         std::array<backend_set_t, FILE_SEG+1>         memToBackend;
         section_map_t                                 sectionMap;
 
+        // Entries of the sections of this memory type might overlap
+        virtual bool mayOverlap (const nixl_mem_t &mem) const { return false; }
+
     public:
         nixlMemSection () {};
 
@@ -81,10 +84,50 @@ class nixlMemSection {
 
 
 class nixlLocalSection : public nixlMemSection {
+    private:
+        // A backend registration shared by coalesced descriptors
+        struct coalescedSpan {
+            nixl_blob_t    metaInfo;
+            nixlBackendMD* metadataP;
+            size_t         views;
+        };
+
+        using span_map_t = std::multimap<nixlBasicDesc, coalescedSpan>;
+        using view_map_t = std::multimap<nixlBasicDesc, span_map_t::iterator>;
+
+        bool                                coalesceReg;
+        // Per section, registered spans and the user descriptors they cover
+        std::map<section_key_t, span_map_t> spanMap;
+        std::map<section_key_t, view_map_t> viewMap;
+
+        bool isCoalesced (const nixl_mem_t &mem) const {
+            return coalesceReg && (mem == DRAM_SEG);
+        }
+
+        bool mayOverlap (const nixl_mem_t &mem) const override {
+            return isCoalesced(mem);
+        }
+
+        void sliceSpans (const section_key_t &sec_key,
+                         const std::map<nixlBackendMD*, span_map_t::iterator> &sliced,
+                         const std::set<nixlBackendMD*> &released);
+
+        nixl_status_t remCoalescedDescList (const nixl_reg_dlist_t &mem_elms,
+                                            nixlBackendEngine* backend);
+
+        nixl_status_t addCoalescedSpans (const section_key_t &sec_key,
+                                         const nixl_reg_dlist_t &mem_elms,
+                                         nixl_sec_dlist_t &resp) const;
+
     public:
+        nixlLocalSection (bool coalesce_reg = false) : coalesceReg(coalesce_reg) {}
+
+        // Registers the descriptors over up to num_threads threads
+        // if the backend supports parallel registration
         nixl_status_t addDescList (const nixl_reg_dlist_t &mem_elms,
                                    nixlBackendEngine* backend,
-                                   nixl_sec_dlist_t &remote_self);
+                                   nixl_sec_dlist_t &remote_self,
+                                   unsigned int num_threads = 1);
 
         // Each nixlBasicDesc should be same as original registration region
         nixl_status_t remDescList (const nixl_reg_dlist_t &mem_elms,
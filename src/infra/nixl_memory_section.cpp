@@ -16,6 +16,11 @@
  */
 #include <map>
 #include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <thread>
 #include "nixl.h"
 #include "nixl_descriptors.h"
 #include "mem_section.h"
@@ -35,6 +40,20 @@ backend_set_t* nixlMemSection::queryBackends (const nixl_mem_t &mem) {
         return &memToBackend[mem];
 }
 
+namespace {
+// Slow path for overlapping entries, where the covering entry is not next to the query
+const nixlSectionDesc* findCovering (const nixl_sec_dlist_t &base,
+                                     const nixlBasicDesc &query,
+                                     bool overlap) {
+    if (!overlap)
+        return nullptr;
+    for (const auto & elm : base)
+        if (elm.covers(query))
+            return &elm;
+    return nullptr;
+}
+};
+
 nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
                                         nixlBackendEngine* backend,
                                         nixl_meta_dlist_t &resp) const {
@@ -52,6 +71,7 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
 
     nixlBasicDesc *p;
     nixl_sec_dlist_t* base = it->second;
+    bool overlap = mayOverlap(query.getType());
     resp.resize(query.descCount());
 
     if (!base->isSorted()) {
@@ -97,8 +117,16 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
                     // TODO: add early termination if already (*q < *s),
                     // but s was not properly covering q
                     if (s_index==size) {
-                        resp.clear();
-                        return NIXL_ERR_UNKNOWN;
+                        s = findCovering(*base, *q, overlap);
+                        if (!s) {
+                            resp.clear();
+                            return NIXL_ERR_UNKNOWN;
+                        }
+                        p = &resp[q_index];
+                        *p = *q;
+                        resp[q_index].metadataP = s->metadataP;
+                        q_index++;
+                        s_index = s - &(*base)[0];
                     }
                 }
             }
@@ -130,10 +158,11 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
                     }
                 }
 
-                if (found) {
+                const nixlSectionDesc *s = found ? &(*itr) : findCovering(*base, *q, overlap);
+                if (s) {
                     p = &resp[i];
                     *p = *q;
-                    resp[i].metadataP = itr->metadataP;
+                    resp[i].metadataP = s->metadataP;
                 } else {
                     resp.clear();
                     return NIXL_ERR_UNKNOWN;
@@ -144,19 +173,230 @@ nixl_status_t nixlMemSection::populate (const nixl_xfer_dlist_t &query,
     }
 }
 
+namespace {
+// Adds the descriptors to a sorted list with a single sort and merge, instead of
+// an insertion per descriptor that shifts the tail of the list each time.
+// Equal descriptors keep their order, same as consecutive addDesc calls.
+template <class Iter>
+void mergeDescs(nixl_sec_dlist_t &target, Iter first, Iter last) {
+    if (!target.isSorted()) {
+        for (; first != last; ++first)
+            target.addDesc(*first);
+        return;
+    }
+
+    size_t old_count = target.descCount();
+    target.resize(old_count + std::distance(first, last));
+    auto tail = std::copy(first, last, target.begin() + old_count);
+    auto added = target.begin() + old_count;
+
+    // Registrations usually come in address order, skip the sort then
+    if (!std::is_sorted(added, tail))
+        std::stable_sort(added, tail);
+
+    // No merge needed when all the new entries go after the existing ones
+    if ((added != target.begin()) && (added != tail) && (*added < *std::prev(added)))
+        std::inplace_merge(target.begin(), added, tail);
+}
+};
+
 /*** Class nixlLocalSection implementation ***/
 
-// Calls into backend engine to register the memories in the desc list
+namespace {
+// Registers a single descriptor with the backend, and fills its section entries
+nixl_status_t registerDesc(nixlBackendEngine* backend,
+                           const nixlBlobDesc &mem_elm,
+                           const nixl_mem_t &nixl_mem,
+                           nixlSectionDesc &local_sec,
+                           nixlSectionDesc &self_sec) {
+    nixlBasicDesc *lp = &local_sec;
+    nixlBasicDesc *rp = &self_sec;
+    nixl_status_t ret;
+
+    // TODO: For now trusting the user, but there can be a more checks mode
+    //       where we find overlaps and split the memories or warn the user
+    ret = backend->registerMem(mem_elm, nixl_mem, local_sec.metadataP);
+    if (ret != NIXL_SUCCESS)
+        return ret;
+
+    if (backend->supportsLocal()) {
+        ret = backend->loadLocalMD(local_sec.metadataP, self_sec.metadataP);
+        if (ret != NIXL_SUCCESS) {
+            backend->deregisterMem(local_sec.metadataP);
+            return ret;
+        }
+    }
+    if (backend->supportsRemote()) {
+        ret = backend->getPublicData(local_sec.metadataP, local_sec.metaBlob);
+        if (ret != NIXL_SUCCESS) {
+            // A backend might use the same object for both initiator/target
+            // side of a transfer, so no need for unloadMD in that case.
+            if (backend->supportsLocal() && self_sec.metadataP != local_sec.metadataP)
+                backend->unloadMD(self_sec.metadataP);
+            backend->deregisterMem(local_sec.metadataP);
+            return ret;
+        }
+    }
+
+    *lp = mem_elm; // Copy the basic desc part
+    if (((nixl_mem == BLK_SEG) || (nixl_mem == OBJ_SEG) ||
+         (nixl_mem == FILE_SEG)) && (lp->len==0))
+        lp->len = SIZE_MAX; // File has no range limit
+
+    if (backend->supportsLocal())
+        *rp = *lp;
+
+    return NIXL_SUCCESS;
+}
+
+// Registers all the descriptors, indexed as in mem_elms so the result doesn't
+// depend on which thread registered them. Nothing is left registered on error.
+nixl_status_t registerDescs(nixlBackendEngine* backend,
+                            const nixl_reg_dlist_t &mem_elms,
+                            unsigned int num_threads,
+                            std::vector<nixlSectionDesc> &local_descs,
+                            std::vector<nixlSectionDesc> &self_descs) {
+    nixl_mem_t nixl_mem = mem_elms.getType();
+    int count = mem_elms.descCount();
+    std::vector<char> registered(count, false);
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    local_descs.resize(count);
+    self_descs.resize(count);
+
+    if ((num_threads > 1) && (count > 1) && backend->supportsParallelReg()) {
+        std::atomic<int> next(0);
+        std::atomic<bool> failed(false);
+        std::mutex ret_lock;
+
+        auto worker = [&]() {
+            while (!failed.load(std::memory_order_relaxed)) {
+                int i = next.fetch_add(1);
+                if (i >= count)
+                    return;
+                nixl_status_t desc_ret = registerDesc(backend, mem_elms[i], nixl_mem,
+                                                      local_descs[i], self_descs[i]);
+                if (desc_ret == NIXL_SUCCESS) {
+                    registered[i] = true;
+                } else {
+                    std::lock_guard<std::mutex> guard(ret_lock);
+                    if (ret == NIXL_SUCCESS)
+                        ret = desc_ret;
+                    failed = true;
+                }
+            }
+        };
+
+        // The calling thread registers too
+        std::vector<std::thread> threads;
+        for (unsigned int t = 1; t < std::min<unsigned int>(num_threads, count); ++t)
+            threads.emplace_back(worker);
+        worker();
+        for (auto & thread : threads)
+            thread.join();
+    } else {
+        for (int i = 0; i < count; ++i) {
+            ret = registerDesc(backend, mem_elms[i], nixl_mem, local_descs[i], self_descs[i]);
+            if (ret != NIXL_SUCCESS)
+                break;
+            registered[i] = true;
+        }
+    }
+
+    if (ret != NIXL_SUCCESS) {
+        for (int j = 0; j < count; ++j) {
+            if (!registered[j])
+                continue;
+            if (backend->supportsLocal() &&
+                self_descs[j].metadataP != local_descs[j].metadataP)
+                backend->unloadMD(self_descs[j].metadataP);
+            backend->deregisterMem(local_descs[j].metadataP);
+        }
+    }
+    return ret;
+}
+
+// Merges contiguous or overlapping descriptors with the same metaInfo into spans.
+// span_of gives the index of the span covering each of the descriptors.
+void buildSpans(const nixl_reg_dlist_t &mem_elms,
+                nixl_reg_dlist_t &spans,
+                std::vector<int> &span_of) {
+    int count = mem_elms.descCount();
+    std::vector<int> order(count);
+
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int a, int b) { return mem_elms[a] < mem_elms[b]; });
+
+    span_of.resize(count);
+    for (int i : order) {
+        const nixlBlobDesc &elm = mem_elms[i];
+        if (!spans.isEmpty()) {
+            nixlBlobDesc &last = spans[spans.descCount() - 1];
+            if ((last.devId == elm.devId) && (last.metaInfo == elm.metaInfo) &&
+                (elm.addr <= last.addr + last.len)) {
+                last.len = std::max(last.addr + last.len, elm.addr + elm.len) - last.addr;
+                span_of[i] = spans.descCount() - 1;
+                continue;
+            }
+        }
+        spans.addDesc(elm);
+        span_of[i] = spans.descCount() - 1;
+    }
+}
+};
+
+// Calls into backend engine to register the memories in the desc list.
+// In coalescing mode the backend registers spans of the descriptors instead,
+// and each descriptor is kept as a view of the span that covers it.
 nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
                                              nixlBackendEngine* backend,
-                                             nixl_sec_dlist_t &remote_self) {
+                                             nixl_sec_dlist_t &remote_self,
+                                             unsigned int num_threads) {
 
     if (!backend)
         return NIXL_ERR_INVALID_PARAM;
-    // Find the MetaDesc list, or add it to the map
     nixl_mem_t     nixl_mem     = mem_elms.getType();
     section_key_t  sec_key      = std::make_pair(nixl_mem, backend);
+    bool           coalesced    = isCoalesced(nixl_mem);
+
+    const nixl_reg_dlist_t *reg_elms = &mem_elms;
+    nixl_reg_dlist_t spans(nixl_mem), new_spans(nixl_mem);
+    std::vector<int> span_of, new_index;
+    std::vector<span_map_t::iterator> span_its;
+
+    if (coalesced) {
+        buildSpans(mem_elms, spans, span_of);
+
+        // Spans covered by an earlier registration reuse it
+        span_map_t &prev_spans = spanMap[sec_key];
+        span_its.resize(spans.descCount(), prev_spans.end());
+        new_index.resize(spans.descCount(), -1);
+        for (int k = 0; k < spans.descCount(); ++k) {
+            const nixlBlobDesc &span = spans[k];
+            auto itr = prev_spans.upper_bound(nixlBasicDesc(span.addr, SIZE_MAX, span.devId));
+            if ((itr != prev_spans.begin()) && std::prev(itr)->first.covers(span) &&
+                (std::prev(itr)->second.metaInfo == span.metaInfo)) {
+                span_its[k] = std::prev(itr);
+                continue;
+            }
+            new_index[k] = new_spans.descCount();
+            new_spans.addDesc(span);
+        }
+        reg_elms = &new_spans;
+    }
 
+    // Register all the entries first, and add them to the lists at once
+    std::vector<nixlSectionDesc> local_descs, self_descs;
+    nixl_status_t ret = registerDescs(backend, *reg_elms, num_threads,
+                                      local_descs, self_descs);
+    if (ret != NIXL_SUCCESS) {
+        if (coalesced && spanMap[sec_key].empty())
+            spanMap.erase(sec_key);
+        return ret;
+    }
+
+    // Find the MetaDesc list, or add it to the map
     auto it = sectionMap.find(sec_key);
     if (it==sectionMap.end()) { // New desc list
         sectionMap[sec_key] = new nixl_sec_dlist_t(nixl_mem, true);
@@ -164,69 +404,38 @@ nixl_status_t nixlLocalSection::addDescList (const nixl_reg_dlist_t &mem_elms,
     }
     nixl_sec_dlist_t *target = sectionMap[sec_key];
 
-    // Add entries to the target list
-    nixlSectionDesc local_sec, self_sec;
-    nixlBasicDesc *lp = &local_sec;
-    nixlBasicDesc *rp = &self_sec;
-    nixl_status_t ret;
-
-    int i;
-    for (i = 0; i < mem_elms.descCount(); ++i) {
-        // TODO: For now trusting the user, but there can be a more checks mode
-        //       where we find overlaps and split the memories or warn the user
-        ret = backend->registerMem(mem_elms[i], nixl_mem, local_sec.metadataP);
-        if (ret != NIXL_SUCCESS)
-            break;
-
-        if (backend->supportsLocal()) {
-            ret = backend->loadLocalMD(local_sec.metadataP, self_sec.metadataP);
-            if (ret != NIXL_SUCCESS) {
-                backend->deregisterMem(local_sec.metadataP);
-                break;
-            }
+    if (coalesced) {
+        span_map_t &sec_spans = spanMap[sec_key];
+        view_map_t &sec_views = viewMap[sec_key];
+        for (int k = 0; k < spans.descCount(); ++k) {
+            if (new_index[k] < 0)
+                continue;
+            coalescedSpan state{spans[k].metaInfo, local_descs[new_index[k]].metadataP, 0};
+            span_its[k] = sec_spans.emplace(spans[k], std::move(state));
         }
-        if (backend->supportsRemote()) {
-            ret = backend->getPublicData(local_sec.metadataP, local_sec.metaBlob);
-            if (ret != NIXL_SUCCESS) {
-                // A backend might use the same object for both initiator/target
-                // side of a transfer, so no need for unloadMD in that case.
-                if (backend->supportsLocal() && self_sec.metadataP != local_sec.metadataP)
-                    backend->unloadMD(self_sec.metadataP);
-                backend->deregisterMem(local_sec.metadataP);
-                break;
-            }
-        }
-
-        *lp = mem_elms[i]; // Copy the basic desc part
-        if (((nixl_mem == BLK_SEG) || (nixl_mem == OBJ_SEG) ||
-             (nixl_mem == FILE_SEG)) && (lp->len==0))
-            lp->len = SIZE_MAX; // File has no range limit
-
-        target->addDesc(local_sec);
-
-        if (backend->supportsLocal()) {
-            *rp = *lp;
-            remote_self.addDesc(self_sec);
+        for (int i = 0; i < mem_elms.descCount(); ++i) {
+            span_its[span_of[i]]->second.views++;
+            sec_views.emplace(mem_elms[i], span_its[span_of[i]]);
         }
     }
 
-    // Abort in case of error
-    if (ret != NIXL_SUCCESS) {
-        for (int j = 0; j < i; ++j) {
-            int index = target->getIndex(mem_elms[j]);
-
-            if (backend->supportsLocal()) {
-                int self_index = remote_self.getIndex(mem_elms[j]);
-                // Should never be negative, as we just added it in previous loop
-                if (self_index >= 0 && remote_self[self_index].metadataP != (*target)[index].metadataP)
-                    backend->unloadMD(remote_self[self_index].metadataP);
-            }
-            backend->deregisterMem((*target)[index].metadataP);
-            target->remDesc(index);
-        }
-        remote_self.clear();
+    mergeDescs(*target, std::make_move_iterator(local_descs.begin()),
+               std::make_move_iterator(local_descs.end()));
+
+    // Reused spans might have been sliced, their entries cover the new views again
+    if (coalesced) {
+        std::map<nixlBackendMD*, span_map_t::iterator> sliced;
+        for (int k = 0; k < spans.descCount(); ++k)
+            if (new_index[k] < 0)
+                sliced.emplace(span_its[k]->second.metadataP, span_its[k]);
+        if (!sliced.empty())
+            sliceSpans(sec_key, sliced, {});
     }
-    return ret;
+    if (backend->supportsLocal())
+        for (auto & elm : self_descs)
+            remote_self.addDesc(elm);
+
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
@@ -238,22 +447,39 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
     auto it = sectionMap.find(sec_key);
     if (it==sectionMap.end())
         return NIXL_ERR_NOT_FOUND;
+    if (isCoalesced(nixl_mem))
+        return remCoalescedDescList(mem_elms, backend);
     nixl_sec_dlist_t *target = it->second;
 
     // First check if the mem_elms are present in the list,
     // don't deregister anything in case any is missing.
+    int count = target->descCount();
+    std::vector<bool> removed(count, false);
     for (auto & elm : mem_elms) {
         int index = target->getIndex(elm);
         if (index < 0)
             return NIXL_ERR_NOT_FOUND;
+        // Same descriptor registered more than once, take the next copy
+        while ((index < count) && removed[index] && ((*target)[index] == elm))
+            index++;
+        if ((index == count) || !((*target)[index] == elm))
+            return NIXL_ERR_NOT_FOUND;
+        removed[index] = true;
     }
 
-    for (auto & elm : mem_elms) {
-        int index = target->getIndex(elm);
-        // Already checked, elm should always be found. Can add a check in debug mode.
-        backend->deregisterMem((*target)[index].metadataP);
-        target->remDesc(index);
+    // Remove all of them in a single pass over the list, instead of
+    // shifting its tail once per removed descriptor
+    int kept = 0;
+    for (int i = 0; i < count; ++i) {
+        if (removed[i]) {
+            backend->deregisterMem((*target)[i].metadataP);
+            continue;
+        }
+        if (kept != i)
+            (*target)[kept] = std::move((*target)[i]);
+        kept++;
     }
+    target->resize(kept);
 
     if (target->descCount()==0) {
         delete target;
@@ -264,6 +490,117 @@ nixl_status_t nixlLocalSection::remDescList (const nixl_reg_dlist_t &mem_elms,
     return NIXL_SUCCESS;
 }
 
+// Rebuilds the entries of the sliced spans from the views they have left, so the
+// deregistered parts of a span are neither found by lookups nor exported.
+// The entries of the released spans are removed, and the spans deregistered.
+void nixlLocalSection::sliceSpans (const section_key_t &sec_key,
+                                   const std::map<nixlBackendMD*, span_map_t::iterator> &sliced,
+                                   const std::set<nixlBackendMD*> &released) {
+    nixlBackendEngine *backend = sec_key.second;
+    nixl_sec_dlist_t *target = sectionMap[sec_key];
+    const view_map_t &sec_views = viewMap[sec_key];
+    std::map<nixlBackendMD*, nixlSectionDesc> entries;
+
+    // Remove the entries of all the spans in a single pass over the list
+    int count = target->descCount();
+    int kept = 0;
+    for (int i = 0; i < count; ++i) {
+        nixlBackendMD *md = (*target)[i].metadataP;
+        if (released.count(md))
+            continue;
+        if (sliced.count(md)) {
+            entries.emplace(md, (*target)[i]);
+            continue;
+        }
+        if (kept != i)
+            (*target)[kept] = std::move((*target)[i]);
+        kept++;
+    }
+    target->resize(kept);
+
+    for (auto md : released)
+        backend->deregisterMem(md);
+
+    // One entry per contiguous range of views, views are sorted by address
+    std::vector<nixlSectionDesc> pieces;
+    for (const auto &[md, span] : sliced) {
+        auto entry = entries.find(md);
+        if (entry == entries.end())
+            continue;
+        const nixlBasicDesc &range = span->first;
+        nixlSectionDesc piece = entry->second;
+        bool open = false;
+
+        for (auto view = sec_views.lower_bound(nixlBasicDesc(range.addr, 0, range.devId));
+             (view != sec_views.end()) && (view->first.devId == range.devId) &&
+             (view->first.addr < range.addr + range.len); ++view) {
+            if (view->second != span)
+                continue;
+            const nixlBasicDesc &elm = view->first;
+            if (open && (elm.addr <= piece.addr + piece.len)) {
+                piece.len = std::max(piece.addr + piece.len, elm.addr + elm.len) - piece.addr;
+                continue;
+            }
+            if (open)
+                pieces.push_back(piece);
+            piece.addr = elm.addr;
+            piece.len = elm.len;
+            open = true;
+        }
+        if (open)
+            pieces.push_back(piece);
+    }
+
+    mergeDescs(*target, std::make_move_iterator(pieces.begin()),
+               std::make_move_iterator(pieces.end()));
+}
+
+// Removes the views, and deregisters the spans that have no views left
+nixl_status_t nixlLocalSection::remCoalescedDescList (const nixl_reg_dlist_t &mem_elms,
+                                                      nixlBackendEngine *backend) {
+    nixl_mem_t     nixl_mem     = mem_elms.getType();
+    section_key_t sec_key = std::make_pair(nixl_mem, backend);
+    auto vit = viewMap.find(sec_key);
+    if (vit == viewMap.end())
+        return NIXL_ERR_NOT_FOUND;
+    view_map_t &sec_views = vit->second;
+    span_map_t &sec_spans = spanMap[sec_key];
+
+    // First check if the mem_elms are all registered, as many times as requested
+    std::map<nixlBasicDesc, size_t> requested;
+    for (auto & elm : mem_elms)
+        if (++requested[elm] > sec_views.count(elm))
+            return NIXL_ERR_NOT_FOUND;
+
+    std::set<nixlBackendMD*> released;
+    std::map<nixlBackendMD*, span_map_t::iterator> sliced;
+    for (auto & elm : mem_elms) {
+        auto view = sec_views.find(elm);
+        auto span = view->second;
+        nixlBackendMD *md = span->second.metadataP;
+        sec_views.erase(view);
+        if (--span->second.views == 0) {
+            released.insert(md);
+            sliced.erase(md);
+            sec_spans.erase(span);
+        } else {
+            sliced.emplace(md, span);
+        }
+    }
+
+    sliceSpans(sec_key, sliced, released);
+
+    if (sectionMap[sec_key]->descCount()==0) {
+        delete sectionMap[sec_key];
+        sectionMap.erase(sec_key);
+        memToBackend[nixl_mem].erase(backend);
+        spanMap.erase(sec_key);
+        viewMap.erase(vit);
+    }
+
+    return NIXL_SUCCESS;
+}
+
 namespace {
 nixl_status_t serializeSections(nixlSerDes* serializer,
                                 const section_map_t &sections) {
@@ -298,6 +635,40 @@ nixl_status_t nixlLocalSection::serialize(nixlSerDes* serializer) const {
     return serializeSections(serializer, sectionMap);
 }
 
+// Adds the section entries covering the views, each entry once
+nixl_status_t nixlLocalSection::addCoalescedSpans (const section_key_t &sec_key,
+                                                   const nixl_reg_dlist_t &mem_elms,
+                                                   nixl_sec_dlist_t &resp) const {
+    auto vit = viewMap.find(sec_key);
+    if (vit == viewMap.end())
+        return NIXL_ERR_NOT_FOUND;
+    const nixl_sec_dlist_t *base = sectionMap.at(sec_key);
+    std::set<int> added;
+
+    for (const auto &desc : mem_elms) {
+        auto view = vit->second.find(desc);
+        if (view == vit->second.end())
+            return NIXL_ERR_NOT_FOUND;
+        const auto &[span, state] = *view->second;
+
+        // The entry of the span covering the view starts between the span and the view
+        auto itr = std::upper_bound(base->begin(), base->end(),
+                                    nixlBasicDesc(desc.addr, SIZE_MAX, desc.devId));
+        bool found = false;
+        while (!found && (itr != base->begin())) {
+            --itr;
+            if ((itr->devId != span.devId) || (itr->addr < span.addr))
+                break;
+            found = (itr->metadataP == state.metadataP) && itr->covers(desc);
+        }
+        if (!found)
+            return NIXL_ERR_NOT_FOUND;
+        if (added.insert(itr - base->begin()).second)
+            resp.addDesc(*itr);
+    }
+    return NIXL_SUCCESS;
+}
+
 nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
                                                  const backend_set_t &backends,
                                                  const nixl_reg_dlist_t &mem_elms) const {
@@ -320,6 +691,13 @@ nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
         //       This will avoid the need to delete the nixl_sec_dlist_t instances.
         const nixl_sec_dlist_t *base = it->second;
         nixl_sec_dlist_t *resp = new nixl_sec_dlist_t(nixl_mem, mem_elms.isSorted());
+        mem_elms_to_serialize.emplace(sec_key, resp);
+        if (isCoalesced(nixl_mem)) {
+            ret = addCoalescedSpans(sec_key, mem_elms, *resp);
+            if (ret != NIXL_SUCCESS)
+                break;
+            continue;
+        }
         for (const auto &desc : mem_elms) {
             int index = base->getIndex(desc);
             if (index < 0) {
@@ -330,7 +708,6 @@ nixl_status_t nixlLocalSection::serializePartial(nixlSerDes* serializer,
         }
         if (ret != NIXL_SUCCESS)
             break;
-        mem_elms_to_serialize.emplace(sec_key, resp);
     }
 
     if (ret == NIXL_SUCCESS)
@@ -441,8 +818,7 @@ nixl_status_t nixlRemoteSection::loadLocalData (
     memToBackend[nixl_mem].insert(backend); // Fine to overwrite, it's a set
     nixl_sec_dlist_t *target = sectionMap[sec_key];
 
-    for (auto & elm: mem_elms)
-        target->addDesc(elm);
+    mergeDescs(*target, mem_elms.begin(), mem_elms.end());
 
     return NIXL_SUCCESS;
 }
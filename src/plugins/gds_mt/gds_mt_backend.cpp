@@ -195,6 +195,7 @@ nixlGdsMtEngine::registerMem (const nixlBlobDesc &mem,
                               nixlBackendMD *&out) {
     switch (nixl_mem) {
     case FILE_SEG: {
+        std::lock_guard<std::mutex> guard (gds_mt_file_map_lock_);
         auto it = gds_mt_file_map_.find (mem.devId);
         std::shared_ptr<gdsMtFileHandle> handle;
         if (it != gds_mt_file_map_.end()) {
@@ -252,6 +253,7 @@ nixlGdsMtEngine::deregisterMem (nixlBackendMD *meta) {
             int key = file_data->handle->fd;
             md.reset(); // Release metadata first
 
+            std::lock_guard<std::mutex> guard (gds_mt_file_map_lock_);
             auto it = gds_mt_file_map_.find (key);
             if (it != gds_mt_file_map_.end() && it->second.expired()) {
                 gds_mt_file_map_.erase (it);
@@ -22,6 +22,7 @@
 #include <nixl_types.h>
 #include <backend/backend_engine.h>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <cufile.h>
@@ -56,6 +57,11 @@ public:
     supportsProgTh() const override {
         return false;
     }
+    // cuFile buffer registration is thread safe, the file map is locked
+    bool
+    supportsParallelReg() const override {
+        return true;
+    }
 
     nixl_mem_list_t
     getSupportedMems() const override {
@@ -111,6 +117,7 @@ public:
 private:
     gdsMtUtil gds_mt_utils_;
     std::unordered_map<int, std::weak_ptr<gdsMtFileHandle>> gds_mt_file_map_;
+    std::mutex gds_mt_file_map_lock_;
     size_t thread_count_;
     std::unique_ptr<tf::Executor> executor_;
 };
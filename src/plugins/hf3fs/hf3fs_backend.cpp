@@ -23,10 +23,56 @@
 #include "common/str_tools.h"
 #include "common/nixl_log.h"
 
-#define NUM_CQES 1024
+// Alignment of the bounce buffers sliced from the iov arena
+#define ARENA_ALIGN 4096
+
+bool nixlHf3fsIovArena::alloc(size_t size, size_t &offset, size_t &alloc_size)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    alloc_size = (size + ARENA_ALIGN - 1) & ~((size_t)ARENA_ALIGN - 1);
+    for (auto it = free_ranges.begin(); it != free_ranges.end(); ++it) {
+        if (it->second < alloc_size) {
+            continue;
+        }
+
+        offset = it->first;
+        size_t left = it->second - alloc_size;
+        free_ranges.erase(it);
+        if (left > 0) {
+            free_ranges.emplace(offset + alloc_size, left);
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void nixlHf3fsIovArena::free(size_t offset, size_t alloc_size)
+{
+    std::lock_guard<std::mutex> guard(lock);
+
+    auto it = free_ranges.emplace(offset, alloc_size).first;
+
+    // Merge with the following and the preceding free ranges
+    auto next = std::next(it);
+    if (next != free_ranges.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        free_ranges.erase(next);
+    }
+    if (it != free_ranges.begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == it->first) {
+            prev->second += it->second;
+            free_ranges.erase(it);
+        }
+    }
+}
 
 nixlHf3fsEngine::nixlHf3fsEngine (const nixlBackendInitParams* init_params)
-    : nixlBackendEngine (init_params)
+    : nixlBackendEngine (init_params),
+      iov_arena(nullptr),
+      reaper(nullptr)
 {
     hf3fs_utils = new hf3fsUtil();
 
@@ -51,6 +97,76 @@ nixlHf3fsEngine::nixlHf3fsEngine (const nixlBackendInitParams* init_params)
     }
 
     hf3fs_utils->mount_point = mount_point_cstr;
+
+    size_t num_reaper_threads = 1;
+    if (init_params &&
+        init_params->customParams &&
+        init_params->customParams->count("num_reaper_threads") > 0) {
+        const std::string &val = init_params->customParams->at("num_reaper_threads");
+        char *eptr;
+        num_reaper_threads = strtoul(val.c_str(), &eptr, 0);
+        if (val.empty() || *eptr != '\0' || num_reaper_threads == 0) {
+            NIXL_ERROR << "Invalid num_reaper_threads: " << val;
+            this->initErr = true;
+            return;
+        }
+    }
+
+    reaper = new nixlHf3fsReaper(hf3fs_utils, num_reaper_threads);
+
+    // Bounce buffers are sliced from a shared iov when set, instead of an iov per I/O
+    size_t arena_size = 0;
+    if (init_params &&
+        init_params->customParams &&
+        init_params->customParams->count("iov_arena_size") > 0) {
+        const std::string &val = init_params->customParams->at("iov_arena_size");
+        char *eptr;
+        arena_size = strtoull(val.c_str(), &eptr, 0);
+        if (val.empty() || *eptr != '\0') {
+            NIXL_ERROR << "Invalid iov_arena_size: " << val;
+            this->initErr = true;
+            return;
+        }
+    }
+
+    if (arena_size > 0 && !this->initErr) {
+        iov_arena = new nixlHf3fsIovArena(arena_size);
+        if (hf3fs_utils->createIOV(&iov_arena->iov, nullptr, arena_size, 0) != NIXL_SUCCESS) {
+            NIXL_WARN << "Failed to create a " << arena_size
+                      << " bytes iov arena, bounce buffers are created per I/O";
+            delete iov_arena;
+            iov_arena = nullptr;
+        }
+    }
+}
+
+nixl_status_t nixlHf3fsEngine::wrapUserIOV(const nixlBlobDesc &mem, nixlHf3fsMetadata *md)
+{
+    const std::string prefix = HF3FS_IOV_META_PREFIX;
+    const std::string &meta = mem.metaInfo;
+    uint8_t id[16];
+
+    if (meta.size() != prefix.size() + 2 * sizeof(id)) {
+        HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
+            absl::StrFormat("Error - invalid hf3fs iov id in metaInfo '%s'", meta));
+    }
+
+    for (size_t i = 0; i < sizeof(id); i++) {
+        const char *hex = meta.c_str() + prefix.size() + 2 * i;
+        if (!isxdigit(hex[0]) || !isxdigit(hex[1])) {
+            HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
+                absl::StrFormat("Error - invalid hf3fs iov id in metaInfo '%s'", meta));
+        }
+        id[i] = (uint8_t) std::stoul(std::string(hex, 2), nullptr, 16);
+    }
+
+    auto status = hf3fs_utils->wrapIOV(&md->iov, (void*) mem.addr, mem.len, 0, id);
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    md->zero_copy = true;
+    return NIXL_SUCCESS;
 }
 
 
@@ -67,6 +183,18 @@ nixl_status_t nixlHf3fsEngine::registerMem (const nixlBlobDesc &mem,
         case DRAM_SEG:
             md->type = DRAM_SEG;
             status = NIXL_SUCCESS;
+            // Memory allocated as an hf3fs iov is used in place, other memory
+            // goes through a bounce buffer at transfer time
+            if (mem.metaInfo.compare(0, strlen(HF3FS_IOV_META_PREFIX),
+                                     HF3FS_IOV_META_PREFIX) == 0) {
+                status = wrapUserIOV(mem, md);
+                if (status != NIXL_SUCCESS) {
+                    delete md;
+                    HF3FS_LOG_RETURN(status,
+                        absl::StrFormat("Error - failed to register memory %p as hf3fs iov",
+                                        (void*) mem.addr));
+                }
+            }
             break;
         case FILE_SEG: {
             fd = mem.devId;
@@ -113,7 +241,10 @@ nixl_status_t nixlHf3fsEngine::deregisterMem (nixlBackendMD* meta)
         hf3fs_file_set.erase (md->handle.fd);
         hf3fs_utils->deregisterFileHandle(md->handle.fd);
     } else if (md->type == DRAM_SEG) {
-        return NIXL_SUCCESS;
+        // The memory itself stays owned by whoever created the iov
+        if (md->zero_copy) {
+            hf3fs_utils->destroyIOV(&md->iov);
+        }
     } else {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error - type not supported");
     }
@@ -123,25 +254,45 @@ nixl_status_t nixlHf3fsEngine::deregisterMem (nixlBackendMD* meta)
 void nixlHf3fsEngine::cleanupIOList(nixlHf3fsBackendReqH *handle) const
 {
     for (auto prev_io : handle->io_list) {
-        hf3fs_utils->destroyIOV(&prev_io->iov);
+        if (prev_io->owns_iov) {
+            hf3fs_utils->destroyIOV(&prev_io->owned_iov);
+        } else if (prev_io->arena_size > 0) {
+            iov_arena->free(prev_io->arena_offset, prev_io->arena_size);
+        }
         delete prev_io;
     }
 
     handle->io_list.clear();
 }
 
-void nixlHf3fsEngine::cleanupIOThread(nixlHf3fsBackendReqH *handle) const
+nixl_status_t nixlHf3fsEngine::setupIO(nixlHf3fsIO *io, const nixlMetaDesc &mem_desc) const
 {
-    if (handle->io_status.thread != nullptr) {
-        handle->io_status.stop_thread = true;
-        handle->io_status.thread->join();
-
-        delete handle->io_status.thread;
-        handle->io_status.thread = nullptr;
-        handle->io_status.error_status = NIXL_SUCCESS;
-        handle->io_status.error_message = "";
-        handle->io_status.stop_thread = false;
+    nixlHf3fsMetadata *mem_md = (nixlHf3fsMetadata *) mem_desc.metadataP;
+
+    // Registered iov: read and write the user memory directly
+    if (mem_md != nullptr && mem_md->zero_copy) {
+        io->iov = &mem_md->iov;
+        io->io_addr = io->orig_addr;
+        return NIXL_SUCCESS;
+    }
+
+    io->bounce = true;
+    if (iov_arena != nullptr &&
+        iov_arena->alloc(io->size, io->arena_offset, io->arena_size)) {
+        io->iov = &iov_arena->iov;
+        io->io_addr = iov_arena->iov.base + io->arena_offset;
+        return NIXL_SUCCESS;
     }
+
+    auto status = hf3fs_utils->createIOV(&io->owned_iov, io->orig_addr, io->size, io->size);
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    io->owns_iov = true;
+    io->iov = &io->owned_iov;
+    io->io_addr = io->owned_iov.base;
+    return NIXL_SUCCESS;
 }
 
 nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
@@ -209,26 +360,14 @@ nixl_status_t nixlHf3fsEngine::prepXfer (const nixl_xfer_op_t &operation,
         io->is_read = is_read;
         io->offset = offset;
 
-        status = hf3fs_utils->createIOV(&io->iov, addr, size, size);
+        status = setupIO(io, (*mem_list)[i]);
         if (status != NIXL_SUCCESS) {
             delete io;
             nixl_err = status;
-            nixl_mesg = "Error: Failed to wrap memory as IOV";
+            nixl_mesg = "Error: Failed to set up IOV";
             goto cleanup_handle;
         }
 
-        // For WRITE operations, copy data from source buffer to IOV buffer
-        // For READ operations, we don't need to copy data now - we'll copy after read completes
-        if (!is_read) {
-            auto mem_copy = memcpy(io->iov.base, addr, size);
-            if (mem_copy == nullptr) {
-                delete io;
-                nixl_err = NIXL_ERR_BACKEND;
-                nixl_mesg = "Error: Failed to copy memory";
-                goto cleanup_handle;
-            }
-        }
-
         io->fd = file_descriptor;
         hf3fs_handle->io_list.push_back(io);
     }
@@ -263,94 +402,37 @@ nixl_status_t nixlHf3fsEngine::postXfer (const nixl_xfer_op_t &operation,
 
     for (auto it = hf3fs_handle->io_list.begin(); it != hf3fs_handle->io_list.end(); ++it) {
         nixlHf3fsIO* io = *it;
-        status = hf3fs_utils->prepIO(&hf3fs_handle->ior, &io->iov, io->iov.base,
+
+        // For WRITE operations through a bounce buffer, copy the data at post time
+        // so a reposted request writes the current content of the source buffer.
+        // READ operations copy after the read completes
+        if (io->bounce && !io->is_read) {
+            memcpy(io->io_addr, io->orig_addr, io->size);
+        }
+
+        status = hf3fs_utils->prepIO(&hf3fs_handle->ior, io->iov, io->io_addr,
                                      io->offset, io->size, io->fd, io->is_read, io);
         if (status != NIXL_SUCCESS) {
             HF3FS_LOG_RETURN(status, "Error: Failed to prepare IO");
         }
     }
 
+    // Account the IOs before they are submitted, so the reaper never sees
+    // more completions than submitted IOs
+    hf3fs_handle->num_ios += hf3fs_handle->io_list.size();
+
     status = hf3fs_utils->postIOR(&hf3fs_handle->ior);
     if (status != NIXL_SUCCESS) {
+        hf3fs_handle->num_ios -= hf3fs_handle->io_list.size();
         HF3FS_LOG_RETURN(status, "Error: Failed to post IOR");
     }
 
-    // postXfer may be called multiple times, so we need to check if the thread is already running
-    if (hf3fs_handle->io_status.thread == nullptr) {
-        hf3fs_handle->io_status.thread = new std::thread(waitForIOsThread, hf3fs_handle,
-                                                         hf3fs_utils);
-        if (hf3fs_handle->io_status.thread == nullptr) {
-            HF3FS_LOG_RETURN(NIXL_ERR_BACKEND, "Error: Failed to create io thread");
-        }
-    }
-
-    hf3fs_handle->num_ios += hf3fs_handle->io_list.size();
+    // No-op if the handle is still reaped from a previous post
+    reaper->add(hf3fs_handle);
 
     return NIXL_IN_PROG;
 }
 
-void nixlHf3fsEngine::waitForIOsThread(void* handle, void *utils)
-{
-    nixlHf3fsBackendReqH* hf3fs_handle = (nixlHf3fsBackendReqH*)handle;
-    hf3fsUtil* hf3fs_utils = (hf3fsUtil*)utils;
-    nixlH3fsThreadStatus* io_status = &hf3fs_handle->io_status;
-    hf3fs_cqe* cqes = new hf3fs_cqe[NUM_CQES];
-
-    while (!io_status->stop_thread && io_status->error_status == NIXL_SUCCESS) {
-        // Check if we've processed all IOs
-        if (hf3fs_handle->completed_ios >= hf3fs_handle->num_ios) {
-            // User may call postXfer multiple times, so we could not exit yet,
-            // so we must wait for stop condition
-            sched_yield();
-            continue;
-        }
-
-        // Use a short timeout to allow thread to check stop condition
-        struct timespec ts;
-        clock_gettime(CLOCK_MONOTONIC, &ts);
-        ts.tv_nsec += 10 * 1000 * 1000; // 10 milliseconds
-        if (ts.tv_nsec >= 1000000000) {
-            ts.tv_sec += 1;
-            ts.tv_nsec -= 1000000000;
-        }
-
-        int num_completed = 0;
-        nixl_status_t status = hf3fs_utils->waitForIOs(&hf3fs_handle->ior, cqes, NUM_CQES, 1, &ts,
-                                                       &num_completed);
-        if (status != NIXL_SUCCESS) {
-            io_status->error_status = status;
-            io_status->error_message = "Error: Failed to wait for IOs";
-            break;
-        }
-
-        if (num_completed > 0) {
-            for (int i = 0; i < num_completed; i++) {
-                if (cqes[i].result < 0) {
-                    io_status->error_status = NIXL_ERR_BACKEND;
-                    io_status->error_message = absl::StrFormat(
-                        "Error: I/O operation completed with error: %d", cqes[i].result);
-                    break;
-                }
-
-                nixlHf3fsIO* io = (nixlHf3fsIO*)cqes[i].userdata;
-
-                if (io->is_read) {
-                    auto mem_copy = memcpy(io->orig_addr, io->iov.base, io->size);
-                    if (mem_copy == nullptr) {
-                        io_status->error_status = NIXL_ERR_BACKEND;
-                        io_status->error_message = "Error: Failed to copy memory after read";
-                        break;
-                    }
-                }
-
-                hf3fs_handle->completed_ios++;
-            }
-        }
-    }
-
-    delete[] cqes;
-}
-
 nixl_status_t nixlHf3fsEngine::checkXfer(nixlBackendReqH* handle) const
 {
     if (handle == nullptr) {
@@ -359,29 +441,21 @@ nixl_status_t nixlHf3fsEngine::checkXfer(nixlBackendReqH* handle) const
 
     nixlHf3fsBackendReqH *hf3fs_handle = (nixlHf3fsBackendReqH *) handle;
 
-    // Check if IOR is initialized
-    if (&hf3fs_handle->ior == nullptr) {
-        HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
-            "Error: IOR is not initialized in checkXfer");
-    }
-
-    if (hf3fs_handle->io_status.thread == nullptr) {
+    if (hf3fs_handle->num_ios == 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_INVALID_PARAM,
-            "Error: io thread is not initialized in checkXfer");
+            "Error: request was not posted in checkXfer");
     }
 
-    if (hf3fs_handle->io_status.error_status != NIXL_SUCCESS) {
-        nixl_status_t error_status = hf3fs_handle->io_status.error_status;
-        std::string error_message = hf3fs_handle->io_status.error_message;
-        cleanupIOThread(hf3fs_handle);
-        HF3FS_LOG_RETURN(error_status, error_message);
+    // The error stays set, the failed IOs never complete
+    nixl_status_t error_status = hf3fs_handle->error_status.load(std::memory_order_acquire);
+    if (error_status != NIXL_SUCCESS) {
+        HF3FS_LOG_RETURN(error_status, hf3fs_handle->error_message);
     }
 
-    if (hf3fs_handle->completed_ios < hf3fs_handle->num_ios) {
+    if (hf3fs_handle->completed_ios.load(std::memory_order_acquire) < hf3fs_handle->num_ios) {
         return NIXL_IN_PROG;
     }
 
-    cleanupIOThread(hf3fs_handle);
     return NIXL_SUCCESS;
 }
 
@@ -389,7 +463,7 @@ nixl_status_t nixlHf3fsEngine::releaseReqH(nixlBackendReqH* handle) const
 {
     nixlHf3fsBackendReqH *hf3fs_handle = (nixlHf3fsBackendReqH *) handle;
 
-    cleanupIOThread(hf3fs_handle);
+    reaper->remove(hf3fs_handle);
     cleanupIOList(hf3fs_handle);
     hf3fs_utils->destroyIOR(&hf3fs_handle->ior);
     delete hf3fs_handle;
@@ -397,6 +471,11 @@ nixl_status_t nixlHf3fsEngine::releaseReqH(nixlBackendReqH* handle) const
 }
 
 nixlHf3fsEngine::~nixlHf3fsEngine() {
+    delete reaper;
+    if (iov_arena != nullptr) {
+        hf3fs_utils->destroyIOV(&iov_arena->iov);
+        delete iov_arena;
+    }
     hf3fs_utils->closeHf3fsDriver();
     delete hf3fs_utils;
 }
@@ -22,55 +22,81 @@
 #include <nixl_types.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <atomic>
 #include <list>
+#include <map>
+#include <mutex>
 #include <unordered_set>
-#include <thread>
 #include "hf3fs_utils.h"
+#include "hf3fs_reaper.h"
 #include "backend/backend_engine.h"
 
+// Prefix of the DRAM metaInfo naming the hf3fs iov that backs the memory,
+// followed by the 32 hex digits of the iov id returned by hf3fs_iovcreate
+#define HF3FS_IOV_META_PREFIX "hf3fs_iov:"
+
 class nixlHf3fsMetadata : public nixlBackendMD {
     public:
         hf3fsFileHandle  handle;
         nixl_mem_t     type;
+        hf3fs_iov      iov;        // Registered iov over the memory, valid if zero_copy
+        bool           zero_copy;  // Transfers use the memory directly, no bounce buffer
 
-        nixlHf3fsMetadata() : nixlBackendMD(true) { }
+        nixlHf3fsMetadata() : nixlBackendMD(true), zero_copy(false) { }
         ~nixlHf3fsMetadata() { }
 };
 
-class nixlHf3fsIO {
+// Long-lived iov created at init, sliced into the bounce buffers of the
+// requests so they don't create and destroy an iov each
+class nixlHf3fsIovArena {
     public:
         hf3fs_iov iov;
-        int fd;
-        void* orig_addr;  // Original memory address for copying after read
-        size_t size;      // Size of the buffer
-        bool is_read;     // Whether this is a read operation
-        size_t offset;    // Offset in the file
 
-        nixlHf3fsIO() : fd(-1), orig_addr(nullptr), size(0), is_read(false) {}
-        ~nixlHf3fsIO() {}
+        nixlHf3fsIovArena(size_t size) : free_ranges{{0, size}} {}
+        ~nixlHf3fsIovArena() {}
+
+        // Returns false if there is no free range large enough
+        bool alloc(size_t size, size_t &offset, size_t &alloc_size);
+        void free(size_t offset, size_t alloc_size);
+
+    private:
+        std::mutex lock;
+        std::map<size_t, size_t> free_ranges;  // Offset to size of the free ranges
 };
 
-class nixlH3fsThreadStatus {
+class nixlHf3fsIO {
     public:
-        std::thread *thread;
-        nixl_status_t error_status;
-        std::string error_message;
-        bool stop_thread;
-
-        nixlH3fsThreadStatus() : thread(nullptr), error_status(NIXL_SUCCESS), error_message(""),
-                                 stop_thread(false) {}
-        ~nixlH3fsThreadStatus() {}
+        hf3fs_iov *iov;       // IOV the I/O targets: registered, arena or owned_iov
+        hf3fs_iov owned_iov;  // Bounce IOV created for this I/O only
+        void* io_addr;        // Address of the I/O inside iov
+        int fd;
+        void* orig_addr;      // Original memory address for copying after read
+        size_t size;          // Size of the buffer
+        bool is_read;         // Whether this is a read operation
+        size_t offset;        // Offset in the file
+        bool bounce;          // Whether the data is copied through io_addr
+        bool owns_iov;        // Whether owned_iov has to be destroyed
+        size_t arena_offset;  // Slice of the arena used as bounce buffer
+        size_t arena_size;    // Size of the slice, 0 if not from the arena
+
+        nixlHf3fsIO() : iov(nullptr), io_addr(nullptr), fd(-1), orig_addr(nullptr), size(0),
+                        is_read(false), offset(0), bounce(false), owns_iov(false),
+                        arena_offset(0), arena_size(0) {}
+        ~nixlHf3fsIO() {}
 };
 
 class nixlHf3fsBackendReqH : public nixlBackendReqH {
     public:
        std::list<nixlHf3fsIO *> io_list;
        hf3fs_ior ior;
-       uint32_t completed_ios;  // Number of completed IOs
-       uint32_t num_ios;        // Number of submitted IOs
-       nixlH3fsThreadStatus io_status;
-
-       nixlHf3fsBackendReqH() : completed_ios(0), num_ios(0) {}
+       std::atomic<uint32_t> completed_ios;     // Number of completed IOs
+       std::atomic<uint32_t> num_ios;           // Number of submitted IOs
+       std::atomic<nixl_status_t> error_status; // First error reported by the reaper
+       std::string error_message;               // Set before error_status
+       int reaper_worker;                       // Reaper thread, -1 until the first post
+
+       nixlHf3fsBackendReqH() : completed_ios(0), num_ios(0), error_status(NIXL_SUCCESS),
+                                reaper_worker(-1) {}
        ~nixlHf3fsBackendReqH() {}
 };
 
@@ -79,10 +105,13 @@ class nixlHf3fsEngine : public nixlBackendEngine {
     private:
         hf3fsUtil                      *hf3fs_utils;
         std::unordered_set<int> hf3fs_file_set;
+        nixlHf3fsIovArena              *iov_arena;
+        nixlHf3fsReaper                *reaper;
+
+        nixl_status_t wrapUserIOV(const nixlBlobDesc &mem, nixlHf3fsMetadata *md);
+        nixl_status_t setupIO(nixlHf3fsIO *io, const nixlMetaDesc &mem_desc) const;
 
         void cleanupIOList(nixlHf3fsBackendReqH *handle) const;
-        void cleanupIOThread(nixlHf3fsBackendReqH *handle) const;
-        static void waitForIOsThread(void* handle, void *utils);
     public:
         nixlHf3fsEngine(const nixlBackendInitParams* init_params);
         ~nixlHf3fsEngine();
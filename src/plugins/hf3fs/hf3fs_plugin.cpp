@@ -44,6 +44,8 @@ static const char* get_plugin_version() {
 // Function to get backend options
 static nixl_b_params_t get_backend_options() {
     nixl_b_params_t params;
+    params["iov_arena_size"] = "0";
+    params["num_reaper_threads"] = "1";
     return params;
 }
 
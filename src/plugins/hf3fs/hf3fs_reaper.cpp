@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cstring>
+#include <time.h>
+#include <absl/strings/str_format.h>
+#include "hf3fs_reaper.h"
+#include "hf3fs_backend.h"
+
+#define NUM_CQES 1024
+// Sweeps without any completion before the reaper stops spinning and sleeps
+#define REAPER_SPIN_SWEEPS 64
+#define REAPER_BACKOFF std::chrono::microseconds(100)
+
+nixlHf3fsReaper::nixlHf3fsReaper(hf3fsUtil *utils, size_t num_threads)
+    : utils(utils), next_worker(0)
+{
+    for (size_t i = 0; i < std::max<size_t>(num_threads, 1); i++) {
+        workers.emplace_back(new worker());
+    }
+
+    for (auto &w : workers) {
+        w->thread = std::thread(&nixlHf3fsReaper::run, this, std::ref(*w));
+    }
+}
+
+nixlHf3fsReaper::~nixlHf3fsReaper()
+{
+    for (auto &w : workers) {
+        {
+            std::lock_guard<std::mutex> guard(w->lock);
+            w->stop = true;
+        }
+        w->cv.notify_one();
+        w->thread.join();
+    }
+}
+
+void nixlHf3fsReaper::add(nixlHf3fsBackendReqH *handle)
+{
+    if (handle->reaper_worker < 0) {
+        handle->reaper_worker = next_worker.fetch_add(1) % workers.size();
+    }
+
+    worker &w = *workers[handle->reaper_worker];
+    std::lock_guard<std::mutex> guard(w.lock);
+    if (w.active.insert(handle).second) {
+        w.cv.notify_one();
+    }
+}
+
+void nixlHf3fsReaper::remove(nixlHf3fsBackendReqH *handle)
+{
+    if (handle->reaper_worker < 0) {
+        return;
+    }
+
+    // The worker only accesses its handles with the lock held
+    worker &w = *workers[handle->reaper_worker];
+    std::lock_guard<std::mutex> guard(w.lock);
+    w.active.erase(handle);
+}
+
+bool nixlHf3fsReaper::reap(nixlHf3fsBackendReqH *handle, hf3fs_cqe *cqes, int num_cqes)
+{
+    // An expired timeout only collects the IOs that are already complete
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    int num_completed = 0;
+    nixl_status_t status = utils->waitForIOs(&handle->ior, cqes, num_cqes, 0, &ts,
+                                             &num_completed);
+    if (status != NIXL_SUCCESS) {
+        handle->error_message = "Error: Failed to wait for IOs";
+        handle->error_status.store(status, std::memory_order_release);
+        return true;
+    }
+
+    for (int i = 0; i < num_completed; i++) {
+        if (cqes[i].result < 0) {
+            handle->error_message = absl::StrFormat(
+                "Error: I/O operation completed with error: %d", cqes[i].result);
+            handle->error_status.store(NIXL_ERR_BACKEND, std::memory_order_release);
+            return true;
+        }
+
+        nixlHf3fsIO* io = (nixlHf3fsIO*)cqes[i].userdata;
+
+        if (io->is_read && io->bounce) {
+            memcpy(io->orig_addr, io->io_addr, io->size);
+        }
+
+        handle->completed_ios.fetch_add(1, std::memory_order_release);
+    }
+
+    return num_completed > 0;
+}
+
+void nixlHf3fsReaper::run(worker &w)
+{
+    std::vector<hf3fs_cqe> cqes(NUM_CQES);
+    unsigned idle_sweeps = 0;
+    std::unique_lock<std::mutex> lock(w.lock);
+
+    while (!w.stop) {
+        if (w.active.empty()) {
+            w.cv.wait(lock, [&w] { return w.stop || !w.active.empty(); });
+            continue;
+        }
+
+        bool progress = false;
+        for (auto it = w.active.begin(); it != w.active.end();) {
+            nixlHf3fsBackendReqH *handle = *it;
+
+            progress |= reap(handle, cqes.data(), cqes.size());
+
+            // Done until the next post, which adds the handle back
+            if (handle->error_status.load(std::memory_order_acquire) != NIXL_SUCCESS ||
+                handle->completed_ios.load(std::memory_order_relaxed) >=
+                handle->num_ios.load(std::memory_order_acquire)) {
+                it = w.active.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        if (progress) {
+            idle_sweeps = 0;
+            continue;
+        }
+
+        // Nothing completed, spin for a while then back off to let the IOs progress
+        if (++idle_sweeps < REAPER_SPIN_SWEEPS) {
+            lock.unlock();
+            sched_yield();
+            lock.lock();
+        } else {
+            w.cv.wait_for(lock, REAPER_BACKOFF);
+        }
+    }
+}
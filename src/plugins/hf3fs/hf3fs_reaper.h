@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __HF3FS_REAPER_H
+#define __HF3FS_REAPER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "hf3fs_utils.h"
+
+class nixlHf3fsBackendReqH;
+
+// Engine wide completion reaper. A fixed set of threads polls the iors of all
+// the requests with IOs in flight and accounts the completions in the handles,
+// instead of a thread per request. Each handle is bound to one thread at its
+// first post so its completions are always reaped in order.
+class nixlHf3fsReaper {
+    public:
+        nixlHf3fsReaper(hf3fsUtil *utils, size_t num_threads);
+        ~nixlHf3fsReaper();
+
+        // Reap the IOs posted on the handle, does nothing if already reaped.
+        // num_ios has to account the IOs before they are submitted
+        void add(nixlHf3fsBackendReqH *handle);
+        // Stop reaping the handle, the reaper doesn't access it after return
+        void remove(nixlHf3fsBackendReqH *handle);
+
+    private:
+        struct worker {
+            std::thread thread;
+            std::mutex lock;
+            std::condition_variable cv;
+            std::unordered_set<nixlHf3fsBackendReqH *> active;
+            bool stop = false;
+        };
+
+        hf3fsUtil *utils;
+        std::vector<std::unique_ptr<worker>> workers;
+        std::atomic<size_t> next_worker;
+
+        void run(worker &w);
+        // Returns true if any IO of the handle completed
+        bool reap(nixlHf3fsBackendReqH *handle, hf3fs_cqe *cqes, int num_cqes);
+};
+
+#endif
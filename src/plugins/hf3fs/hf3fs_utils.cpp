@@ -49,12 +49,12 @@ void hf3fsUtil::deregisterFileHandle(int fd)
     hf3fs_dereg_fd(fd);
 }
 
-nixl_status_t hf3fsUtil::wrapIOV(struct hf3fs_iov *iov, void *addr, size_t size, size_t block_size)
+nixl_status_t hf3fsUtil::wrapIOV(struct hf3fs_iov *iov, void *addr, size_t size, size_t block_size,
+                                 const uint8_t id[16])
 {
-    // Create a dummy ID - you might want a more sophisticated approach
-    uint8_t dummy_id[16] = {0};
-
-    auto ret = hf3fs_iovwrap(iov, addr, dummy_id, this->mount_point.c_str(), size, 0, -1);
+    // The id names the shared memory hf3fs_iovcreate registered with the fuse daemon,
+    // wrapping lets this process do I/O on it without another copy
+    auto ret = hf3fs_iovwrap(iov, addr, id, this->mount_point.c_str(), size, block_size, -1);
 
     if (ret < 0) {
         HF3FS_LOG_RETURN(NIXL_ERR_BACKEND,
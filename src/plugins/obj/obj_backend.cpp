@@ -16,14 +16,18 @@
  */
 
 #include "obj_backend.h"
+#include "obj_local_fs_client.h"
 #include "common/nixl_log.h"
 #include "nixl_types.h"
 #include <absl/strings/str_format.h>
 #include <memory>
-#include <future>
+#include <atomic>
 #include <vector>
 #include <chrono>
 #include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
 
 namespace {
 
@@ -34,6 +38,88 @@ getNumThreads (nixl_b_params_t *custom_params) {
         std::max (1u, std::thread::hardware_concurrency() / 2);
 }
 
+// S3 limits, every part but the last must be at least 5MiB and there are at most 10000 parts
+constexpr std::size_t minPartSize = 5 * 1024 * 1024;
+constexpr std::size_t maxParts = 10000;
+
+std::size_t
+getMultipartPartSize (nixl_b_params_t *custom_params) {
+    std::size_t part_size = custom_params && custom_params->count ("multipart_part_size") > 0 ?
+        std::stoul (custom_params->at ("multipart_part_size")) :
+        16 * 1024 * 1024;
+    if (part_size < minPartSize)
+        throw std::invalid_argument (absl::StrFormat (
+            "multipart_part_size %d is below the S3 minimum of %d", part_size, minPartSize));
+    return part_size;
+}
+
+std::size_t
+getMultipartConcurrency (nixl_b_params_t *custom_params) {
+    std::size_t concurrency = custom_params && custom_params->count ("multipart_concurrency") > 0 ?
+        std::stoul (custom_params->at ("multipart_concurrency")) :
+        8;
+    return std::max<std::size_t> (concurrency, 1);
+}
+
+// Bounds of the adaptive read chunk size
+constexpr std::size_t initialReadChunkSize = 16 * 1024 * 1024;
+constexpr std::size_t minReadChunkSize = 1024 * 1024;
+constexpr std::size_t maxReadChunkSize = 256 * 1024 * 1024;
+
+// Returns 0 when the chunk size is adaptive
+std::size_t
+getReadChunkSize (nixl_b_params_t *custom_params) {
+    if (!custom_params || custom_params->count ("read_chunk_size") == 0 ||
+        custom_params->at ("read_chunk_size") == "auto")
+        return 0;
+
+    std::size_t chunk_size = std::stoul (custom_params->at ("read_chunk_size"));
+    if (chunk_size == 0) throw std::invalid_argument ("read_chunk_size must be positive or auto");
+    return chunk_size;
+}
+
+std::size_t
+getReadConcurrency (nixl_b_params_t *custom_params) {
+    std::size_t concurrency = custom_params && custom_params->count ("read_concurrency") > 0 ?
+        std::stoul (custom_params->at ("read_concurrency")) :
+        8;
+    return std::max<std::size_t> (concurrency, 1);
+}
+
+// Packing is enabled by a positive pack_max_size
+std::shared_ptr<nixlObjPacker>
+createPacker (nixl_b_params_t *custom_params, std::shared_ptr<IS3Client> s3_client) {
+    auto param = [custom_params] (const std::string &name, const std::string &default_value) {
+        return custom_params && custom_params->count (name) > 0 ? custom_params->at (name) :
+                                                                   default_value;
+    };
+
+    nixlObjPacker::params params;
+    params.max_object_size = std::stoul (param ("pack_max_size", "0"));
+    if (params.max_object_size == 0) return nullptr;
+
+    params.segment_size = std::stoul (param ("pack_segment_size", "67108864"));
+    params.compact_ratio = std::stod (param ("pack_compact_ratio", "0.5"));
+    params.prefix = param ("pack_prefix", "nixl-pack/");
+    params.persist_index = param ("pack_index", "false") == "true";
+    if (params.segment_size < params.max_object_size)
+        throw std::invalid_argument (
+            absl::StrFormat ("pack_segment_size %d is below pack_max_size %d",
+                             params.segment_size,
+                             params.max_object_size));
+
+    return std::make_shared<nixlObjPacker> (std::move (s3_client), std::move (params));
+}
+
+// Objects are files of local_dir when it is set, for measuring the data path without S3
+std::shared_ptr<IS3Client>
+createS3Client (nixl_b_params_t *custom_params,
+                std::shared_ptr<AsioThreadPoolExecutor> executor) {
+    if (custom_params && custom_params->count ("local_dir") > 0)
+        return std::make_shared<LocalFsS3Client> (custom_params->at ("local_dir"), executor);
+    return std::make_shared<AwsS3Client> (custom_params, executor);
+}
+
 bool
 isValidPrepXferParams (const nixl_xfer_op_t &operation,
                        const nixl_meta_dlist_t &local,
@@ -66,29 +152,47 @@ isValidPrepXferParams (const nixl_xfer_op_t &operation,
     return true;
 }
 
+// Completion of the S3 operations of one posted request. The callbacks update it,
+// so it is shared with them and outlives a handle released before they run.
+class nixlObjXferStatus {
+public:
+    explicit nixlObjXferStatus (size_t pending) : pending_ (pending) {}
+
+    void
+    complete (nixl_status_t status) {
+        if (status != NIXL_SUCCESS) {
+            nixl_status_t expected = NIXL_SUCCESS;
+            first_error_.compare_exchange_strong (expected, status);
+        }
+        // Release the writes to the local buffers to the thread polling the status
+        pending_.fetch_sub (1, std::memory_order_release);
+    }
+
+    nixl_status_t
+    get() const {
+        // Load the count first, an error stored before the last completion is then visible
+        size_t pending = pending_.load (std::memory_order_acquire);
+        nixl_status_t error = first_error_.load (std::memory_order_relaxed);
+        if (error != NIXL_SUCCESS) return error;
+        return pending == 0 ? NIXL_SUCCESS : NIXL_IN_PROG;
+    }
+
+private:
+    std::atomic<size_t> pending_;
+    std::atomic<nixl_status_t> first_error_{NIXL_SUCCESS};
+};
+
 class nixlObjBackendReqH : public nixlBackendReqH {
 public:
     nixlObjBackendReqH() = default;
     ~nixlObjBackendReqH() = default;
 
-    std::vector<std::future<nixl_status_t>> status_futures_;
+    // Null until the request is posted
+    std::shared_ptr<nixlObjXferStatus> status_;
 
     nixl_status_t
-    getOverallStatus() {
-        while (!status_futures_.empty()) {
-            if (status_futures_.back().wait_for (std::chrono::seconds (0)) ==
-                std::future_status::ready) {
-                auto current_status = status_futures_.back().get();
-                if (current_status != NIXL_SUCCESS) {
-                    status_futures_.clear();
-                    return current_status;
-                }
-                status_futures_.pop_back();
-            } else {
-                return NIXL_IN_PROG;
-            }
-        }
-        return NIXL_SUCCESS;
+    getOverallStatus() const {
+        return status_ ? status_->get() : NIXL_SUCCESS;
     }
 };
 
@@ -106,6 +210,294 @@ public:
     std::string obj_key;
 };
 
+// One part of a multipart upload, gathered from several descriptors when they are
+// smaller than the part size
+struct nixlObjPart {
+    std::vector<std::pair<uintptr_t, size_t>> segments;
+    size_t len = 0;
+};
+
+// Split the descriptors written to one object into parts. S3 cannot modify a range
+// of an existing object, so the descriptors must cover the object from offset 0
+// without gaps or overlaps.
+bool
+planParts (const nixl_meta_dlist_t &local,
+           const nixl_meta_dlist_t &remote,
+           std::vector<int> &descs,
+           size_t part_size,
+           std::vector<nixlObjPart> &parts) {
+    std::sort (descs.begin(), descs.end(), [&remote] (int a, int b) {
+        return remote[a].addr < remote[b].addr;
+    });
+
+    size_t total = 0;
+    for (int i : descs) {
+        if (remote[i].addr != total) {
+            NIXL_ERROR << absl::StrFormat (
+                "Error: Descriptors written to an object must cover it contiguously from offset "
+                "0, expected offset %d but got %d",
+                total,
+                remote[i].addr);
+            return false;
+        }
+        total += local[i].len;
+    }
+
+    part_size = std::max (part_size, (total + maxParts - 1) / maxParts);
+
+    parts.emplace_back();
+    for (int i : descs) {
+        uintptr_t addr = local[i].addr;
+        size_t remaining = local[i].len;
+        while (remaining > 0) {
+            if (parts.back().len == part_size) parts.emplace_back();
+            auto &part = parts.back();
+            size_t len = std::min (remaining, part_size - part.len);
+            part.segments.emplace_back (addr, len);
+            part.len += len;
+            addr += len;
+            remaining -= len;
+        }
+    }
+
+    return true;
+}
+
+// Uploads the parts of one object, at most concurrency of them at a time, then
+// completes the upload, or aborts it if any part failed.
+class nixlObjMultipartUpload : public std::enable_shared_from_this<nixlObjMultipartUpload> {
+public:
+    nixlObjMultipartUpload (std::shared_ptr<IS3Client> s3_client,
+                            std::string key,
+                            std::vector<nixlObjPart> parts,
+                            size_t concurrency)
+        : s3_client_ (std::move (s3_client)),
+          key_ (std::move (key)),
+          parts_ (std::move (parts)),
+          concurrency_ (concurrency),
+          etags_ (parts_.size()),
+          staging_ (parts_.size()) {}
+
+    void
+    start (std::shared_ptr<nixlObjXferStatus> status) {
+        status_ = std::move (status);
+        s3_client_->CreateMultipartUploadAsync (
+            key_, [self = shared_from_this()] (bool success, const std::string &upload_id) {
+                self->onCreated (success, upload_id);
+            });
+    }
+
+private:
+    void
+    onCreated (bool success, const std::string &upload_id) {
+        if (!success) {
+            NIXL_ERROR << "Failed to create a multipart upload for object " << key_;
+            status_->complete (NIXL_ERR_BACKEND);
+            return;
+        }
+
+        size_t count;
+        {
+            std::lock_guard<std::mutex> guard (lock_);
+            upload_id_ = upload_id;
+            count = std::min (concurrency_, parts_.size());
+            next_part_ = count;
+            inflight_ = count;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            uploadPart (i);
+    }
+
+    void
+    uploadPart (size_t idx) {
+        const auto &part = parts_[idx];
+        uintptr_t data_ptr = part.segments.empty() ? 0 : part.segments[0].first;
+
+        if (part.segments.size() > 1) {
+            // Only the parts in flight are staged, bounding the copy to concurrency parts
+            staging_[idx] = std::make_unique<char[]> (part.len);
+            char *dst = staging_[idx].get();
+            for (const auto &[addr, len] : part.segments) {
+                std::memcpy (dst, reinterpret_cast<const void *> (addr), len);
+                dst += len;
+            }
+            data_ptr = reinterpret_cast<uintptr_t> (staging_[idx].get());
+        }
+
+        s3_client_->UploadPartAsync (
+            key_,
+            upload_id_,
+            static_cast<int> (idx + 1),
+            data_ptr,
+            part.len,
+            [self = shared_from_this(), idx] (bool success, const std::string &etag) {
+                self->onPartDone (idx, success, etag);
+            });
+    }
+
+    void
+    onPartDone (size_t idx, bool success, const std::string &etag) {
+        bool launch = false, finished = false;
+        size_t next = 0;
+        {
+            std::lock_guard<std::mutex> guard (lock_);
+            staging_[idx].reset();
+            if (success)
+                etags_[idx] = etag;
+            else
+                failed_ = true;
+
+            if (!failed_ && next_part_ < parts_.size()) {
+                next = next_part_++;
+                launch = true;
+            } else {
+                finished = --inflight_ == 0;
+            }
+        }
+
+        if (launch)
+            uploadPart (next);
+        else if (finished)
+            finish();
+    }
+
+    void
+    finish() {
+        auto self = shared_from_this();
+        if (failed_) {
+            NIXL_ERROR << "Failed to upload a part of object " << key_
+                       << ", aborting the multipart upload";
+            s3_client_->AbortMultipartUploadAsync (key_, upload_id_, [self] (bool success) {
+                if (!success)
+                    NIXL_WARN << "Failed to abort the multipart upload of object " << self->key_;
+                self->status_->complete (NIXL_ERR_BACKEND);
+            });
+            return;
+        }
+
+        s3_client_->CompleteMultipartUploadAsync (
+            key_, upload_id_, etags_, [self] (bool success) {
+                self->status_->complete (success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
+            });
+    }
+
+    const std::shared_ptr<IS3Client> s3_client_;
+    const std::string key_;
+    const std::vector<nixlObjPart> parts_;
+    const size_t concurrency_;
+    std::shared_ptr<nixlObjXferStatus> status_;
+
+    std::mutex lock_;
+    std::string upload_id_;
+    std::vector<std::string> etags_;
+    std::vector<std::unique_ptr<char[]>> staging_;
+    size_t next_part_ = 0;
+    size_t inflight_ = 0;
+    bool failed_ = false;
+};
+
+// Reads one descriptor with ranged GETs of its chunks, at most concurrency of them
+// at a time, directly into their offsets of the destination buffer
+class nixlObjRangedGet : public std::enable_shared_from_this<nixlObjRangedGet> {
+public:
+    nixlObjRangedGet (std::shared_ptr<IS3Client> s3_client,
+                      std::string key,
+                      uintptr_t data_ptr,
+                      size_t offset,
+                      std::vector<size_t> chunk_lens,
+                      size_t concurrency,
+                      std::shared_ptr<nixlObjRangeTuner> tuner)
+        : s3_client_ (std::move (s3_client)),
+          key_ (std::move (key)),
+          data_ptr_ (data_ptr),
+          offset_ (offset),
+          concurrency_ (concurrency),
+          tuner_ (std::move (tuner)) {
+        size_t chunk_offset = 0;
+        for (size_t len : chunk_lens) {
+            chunks_.emplace_back (chunk_offset, len);
+            chunk_offset += len;
+        }
+    }
+
+    void
+    start (std::shared_ptr<nixlObjXferStatus> status) {
+        status_ = std::move (status);
+        size_t count;
+        {
+            std::lock_guard<std::mutex> guard (lock_);
+            count = std::min (concurrency_, chunks_.size());
+            next_chunk_ = count;
+            inflight_ = count;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+            getChunk (i);
+    }
+
+private:
+    void
+    getChunk (size_t idx) {
+        const auto [chunk_offset, len] = chunks_[idx];
+        const auto start_time = std::chrono::steady_clock::now();
+
+        s3_client_->GetObjectAsync (
+            key_,
+            data_ptr_ + chunk_offset,
+            len,
+            offset_ + chunk_offset,
+            [self = shared_from_this(), idx, start_time] (bool success) {
+                self->onChunkDone (idx, success, start_time);
+            });
+    }
+
+    void
+    onChunkDone (size_t idx,
+                 bool success,
+                 std::chrono::steady_clock::time_point start_time) {
+        if (success && tuner_)
+            tuner_->record (chunks_[idx].second,
+                            std::chrono::duration_cast<std::chrono::microseconds> (
+                                std::chrono::steady_clock::now() - start_time));
+
+        bool launch = false, finished = false;
+        size_t next = 0;
+        {
+            std::lock_guard<std::mutex> guard (lock_);
+            if (!success) failed_ = true;
+
+            if (!failed_ && next_chunk_ < chunks_.size()) {
+                next = next_chunk_++;
+                launch = true;
+            } else {
+                finished = --inflight_ == 0;
+            }
+        }
+
+        // Chunks in flight still write to the buffer, report a failure only after them
+        if (launch)
+            getChunk (next);
+        else if (finished)
+            status_->complete (failed_ ? NIXL_ERR_BACKEND : NIXL_SUCCESS);
+    }
+
+    const std::shared_ptr<IS3Client> s3_client_;
+    const std::string key_;
+    const uintptr_t data_ptr_;
+    const size_t offset_;
+    const size_t concurrency_;
+    const std::shared_ptr<nixlObjRangeTuner> tuner_;
+    std::shared_ptr<nixlObjXferStatus> status_;
+    // Offset in the descriptor and length of every chunk
+    std::vector<std::pair<size_t, size_t>> chunks_;
+
+    std::mutex lock_;
+    size_t next_chunk_ = 0;
+    size_t inflight_ = 0;
+    bool failed_ = false;
+};
+
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -116,7 +508,17 @@ nixlObjEngine::nixlObjEngine (const nixlBackendInitParams *init_params)
     : nixlBackendEngine (init_params),
       executor_ (
           std::make_shared<AsioThreadPoolExecutor> (getNumThreads (init_params->customParams))),
-      s3_client_ (std::make_shared<AwsS3Client> (init_params->customParams, executor_)) {
+      s3_client_ (createS3Client (init_params->customParams, executor_)),
+      multipart_part_size_ (getMultipartPartSize (init_params->customParams)),
+      multipart_concurrency_ (getMultipartConcurrency (init_params->customParams)),
+      read_chunk_size_ (getReadChunkSize (init_params->customParams)),
+      read_concurrency_ (getReadConcurrency (init_params->customParams)),
+      range_tuner_ (read_chunk_size_ ? nullptr :
+                                       std::make_shared<nixlObjRangeTuner> (initialReadChunkSize,
+                                                                            minReadChunkSize,
+                                                                            maxReadChunkSize)),
+      packer_ (createPacker (init_params->customParams, s3_client_)) {
+    if (packer_) packer_->loadIndex();
     NIXL_INFO << "Object storage backend initialized with S3 client wrapper";
 }
 
@@ -125,12 +527,23 @@ nixlObjEngine::nixlObjEngine (const nixlBackendInitParams *init_params,
                               std::shared_ptr<IS3Client> s3_client)
     : nixlBackendEngine (init_params),
       executor_ (std::make_shared<AsioThreadPoolExecutor> (std::thread::hardware_concurrency())),
-      s3_client_ (s3_client) {
+      s3_client_ (s3_client),
+      multipart_part_size_ (getMultipartPartSize (init_params->customParams)),
+      multipart_concurrency_ (getMultipartConcurrency (init_params->customParams)),
+      read_chunk_size_ (getReadChunkSize (init_params->customParams)),
+      read_concurrency_ (getReadConcurrency (init_params->customParams)),
+      range_tuner_ (read_chunk_size_ ? nullptr :
+                                       std::make_shared<nixlObjRangeTuner> (initialReadChunkSize,
+                                                                            minReadChunkSize,
+                                                                            maxReadChunkSize)),
+      packer_ (createPacker (init_params->customParams, s3_client_)) {
     s3_client_->setExecutor (executor_);
+    if (packer_) packer_->loadIndex();
     NIXL_INFO << "Object storage backend initialized with injected S3 client";
 }
 
 nixlObjEngine::~nixlObjEngine() {
+    if (packer_) packer_->close();
     executor_->WaitUntilStopped();
 }
 
@@ -187,44 +600,150 @@ nixlObjEngine::postXfer (const nixl_xfer_op_t &operation,
                          const nixl_opt_b_args_t *opt_args) const {
     nixlObjBackendReqH *req_h = static_cast<nixlObjBackendReqH *> (handle);
 
+    // Resolve the object of every descriptor before issuing any request
+    std::vector<const std::string *> desc_keys (local.descCount());
     for (int i = 0; i < local.descCount(); ++i) {
-        const auto &local_desc = local[i];
-        const auto &remote_desc = remote[i];
-
-        auto obj_key_search = dev_id_to_obj_key_.find (remote_desc.devId);
+        auto obj_key_search = dev_id_to_obj_key_.find (remote[i].devId);
         if (obj_key_search == dev_id_to_obj_key_.end()) {
-            NIXL_ERROR << "The object segment key " << remote_desc.devId
+            NIXL_ERROR << "The object segment key " << remote[i].devId
                        << " is not registered with the backend";
             return NIXL_ERR_INVALID_PARAM;
         }
+        desc_keys[i] = &obj_key_search->second;
+    }
+
+    // Descriptors transferred with one request each
+    std::vector<int> single_descs;
+    std::vector<std::shared_ptr<nixlObjMultipartUpload>> uploads;
+    std::vector<std::shared_ptr<nixlObjRangedGet>> gets;
+    std::vector<std::shared_ptr<nixlObjPendingSegment>> packed_segments;
+    std::vector<std::pair<int, nixlObjPackedRange>> packed_reads;
+
+    if (operation == NIXL_WRITE) {
+        // An object written by several descriptors, or by one larger than a part,
+        // is assembled by a multipart upload
+        std::vector<const std::string *> keys;
+        std::unordered_map<const std::string *, std::vector<int>> key_descs;
+        for (int i = 0; i < local.descCount(); ++i) {
+            auto &descs = key_descs[desc_keys[i]];
+            if (descs.empty()) keys.push_back (desc_keys[i]);
+            descs.push_back (i);
+        }
+
+        // Small objects written whole are packed, others replace their packed version
+        std::vector<nixlObjPacker::write> packed_writes;
+        std::vector<const std::string *> unpacked_keys;
+
+        for (const std::string *key : keys) {
+            auto &descs = key_descs[key];
+            const bool whole = descs.size() == 1 && remote[descs[0]].addr == 0;
+            if (packer_ && whole && packer_->shouldPack (local[descs[0]].len)) {
+                packed_writes.push_back ({key, local[descs[0]].addr, local[descs[0]].len});
+                continue;
+            }
+            if (packer_) unpacked_keys.push_back (key);
+
+            if (whole && local[descs[0]].len <= multipart_part_size_) {
+                single_descs.push_back (descs[0]);
+                continue;
+            }
+
+            std::vector<nixlObjPart> parts;
+            if (!planParts (local, remote, descs, multipart_part_size_, parts))
+                return NIXL_ERR_INVALID_PARAM;
+
+            uploads.push_back (std::make_shared<nixlObjMultipartUpload> (
+                s3_client_, *key, std::move (parts), multipart_concurrency_));
+        }
+
+        if (packer_) {
+            for (const std::string *key : unpacked_keys)
+                packer_->invalidate (*key);
+            packed_segments = packer_->pack (packed_writes);
+        }
+    } else {
+        const size_t chunk_size = range_tuner_ ? range_tuner_->getChunkSize() : read_chunk_size_;
+        // Shorter first chunks give the tuner the size variation it needs to fit
+        const bool probe = range_tuner_ && range_tuner_->needsProbe();
+
+        for (int i = 0; i < local.descCount(); ++i) {
+            if (packer_) {
+                nixlObjPackedRange range;
+                nixl_status_t status =
+                    packer_->lookup (*desc_keys[i], remote[i].addr, local[i].len, range);
+                if (status == NIXL_SUCCESS) {
+                    packed_reads.emplace_back (i, std::move (range));
+                    continue;
+                }
+                if (status != NIXL_ERR_NOT_FOUND) {
+                    for (const auto &packed_read : packed_reads)
+                        packer_->release (packed_read.second);
+                    return status;
+                }
+            }
+
+            size_t len = local[i].len;
+            if (len <= chunk_size) {
+                single_descs.push_back (i);
+                continue;
+            }
+
+            std::vector<size_t> chunk_lens;
+            if (probe) {
+                chunk_lens.push_back (chunk_size / 2);
+                len -= chunk_size / 2;
+            }
+            for (; len > 0; len -= chunk_lens.back())
+                chunk_lens.push_back (std::min (len, chunk_size));
+
+            gets.push_back (std::make_shared<nixlObjRangedGet> (s3_client_,
+                                                                *desc_keys[i],
+                                                                local[i].addr,
+                                                                remote[i].addr,
+                                                                std::move (chunk_lens),
+                                                                read_concurrency_,
+                                                                range_tuner_));
+        }
+    }
+
+    // Every operation completes the request status once, a multipart upload, a
+    // ranged GET or a packed segment after all its own requests
+    auto status = std::make_shared<nixlObjXferStatus> (uploads.size() + gets.size() +
+                                                       single_descs.size() +
+                                                       packed_segments.size() +
+                                                       packed_reads.size());
+    req_h->status_ = status;
 
-        auto status_promise = std::make_shared<std::promise<nixl_status_t>>();
-        req_h->status_futures_.push_back (status_promise->get_future());
+    // S3 client interface signals completion via a callback, but NIXL API polls request handle
+    // for the status code. The callbacks update the shared status the handle polls.
+    auto callback = [status] (bool success) {
+        status->complete (success ? NIXL_SUCCESS : NIXL_ERR_BACKEND);
+    };
+
+    for (auto &upload : uploads)
+        upload->start (status);
+
+    for (auto &get : gets)
+        get->start (status);
+
+    for (auto &segment : packed_segments)
+        packer_->upload (std::move (segment), callback);
+
+    for (const auto &[i, range] : packed_reads)
+        packer_->read (range, local[i].addr, callback);
+
+    for (int i : single_descs) {
+        const auto &local_desc = local[i];
+        const auto &remote_desc = remote[i];
 
         uintptr_t data_ptr = local_desc.addr;
         size_t data_len = local_desc.len;
         size_t offset = remote_desc.addr;
 
-        // S3 client interface signals completion via a callback, but NIXL API polls request handle
-        // for the status code. Use future/promise pair to bridge the gap.
         if (operation == NIXL_WRITE)
-            s3_client_->PutObjectAsync (obj_key_search->second,
-                                        data_ptr,
-                                        data_len,
-                                        offset,
-                                        [status_promise] (bool success) {
-                                            status_promise->set_value (success ? NIXL_SUCCESS :
-                                                                                 NIXL_ERR_BACKEND);
-                                        });
+            s3_client_->PutObjectAsync (*desc_keys[i], data_ptr, data_len, offset, callback);
         else
-            s3_client_->GetObjectAsync (obj_key_search->second,
-                                        data_ptr,
-                                        data_len,
-                                        offset,
-                                        [status_promise] (bool success) {
-                                            status_promise->set_value (success ? NIXL_SUCCESS :
-                                                                                 NIXL_ERR_BACKEND);
-                                        });
+            s3_client_->GetObjectAsync (*desc_keys[i], data_ptr, data_len, offset, callback);
     }
 
     return NIXL_IN_PROG;
@@ -20,6 +20,8 @@
 
 #include "obj_executor.h"
 #include "obj_s3_client.h"
+#include "obj_range_tuner.h"
+#include "obj_packer.h"
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -108,6 +110,16 @@ private:
     std::shared_ptr<AsioThreadPoolExecutor> executor_;
     std::shared_ptr<IS3Client> s3_client_;
     std::unordered_map<uint64_t, std::string> dev_id_to_obj_key_;
+    // Writes larger than a part, or split over several descriptors, use multipart uploads
+    size_t multipart_part_size_;
+    size_t multipart_concurrency_;
+    // Reads larger than a chunk are split into concurrent ranged GETs, the chunk size
+    // is fixed or learned by the tuner
+    size_t read_chunk_size_;
+    size_t read_concurrency_;
+    std::shared_ptr<nixlObjRangeTuner> range_tuner_;
+    // Packs small objects into segment objects, null when packing is disabled
+    std::shared_ptr<nixlObjPacker> packer_;
 };
 
 #endif // OBJ_BACKEND_H
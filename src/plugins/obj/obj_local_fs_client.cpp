@@ -0,0 +1,303 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "obj_local_fs_client.h"
+#include "common/nixl_log.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+bool
+writeAll (int fd, const char *buf, size_t len, off_t offset) {
+    while (len > 0) {
+        ssize_t ret = pwrite (fd, buf, len, offset);
+        if (ret < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        buf += ret;
+        len -= ret;
+        offset += ret;
+    }
+    return true;
+}
+
+// Returns the number of bytes read, short at the end of the file, or -1
+ssize_t
+readAll (int fd, char *buf, size_t len, off_t offset) {
+    size_t done = 0;
+    while (done < len) {
+        ssize_t ret = pread (fd, buf + done, len - done, offset + done);
+        if (ret < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        if (ret == 0) break;
+        done += ret;
+    }
+    return done;
+}
+
+// Appends a whole file to another, in the kernel when the filesystem supports it
+bool
+appendFile (int in_fd, int out_fd, size_t len) {
+    while (len > 0) {
+        ssize_t ret = copy_file_range (in_fd, nullptr, out_fd, nullptr, len, 0);
+        if (ret > 0) {
+            len -= ret;
+            continue;
+        }
+        if (ret == 0) return false;
+        if (errno == EINTR) continue;
+        if (errno != EXDEV && errno != EINVAL && errno != ENOSYS && errno != EOPNOTSUPP)
+            return false;
+
+        char buf[64 * 1024];
+        while (len > 0) {
+            ssize_t rd = read (in_fd, buf, std::min (len, sizeof (buf)));
+            if (rd < 0 && errno == EINTR) continue;
+            if (rd <= 0) return false;
+            for (ssize_t off = 0; off < rd;) {
+                ssize_t wr = write (out_fd, buf + off, rd - off);
+                if (wr < 0 && errno == EINTR) continue;
+                if (wr < 0) return false;
+                off += wr;
+            }
+            len -= rd;
+        }
+    }
+    return true;
+}
+
+bool
+createParentDirs (const std::string &path) {
+    std::error_code ec;
+    std::filesystem::create_directories (std::filesystem::path (path).parent_path(), ec);
+    return !ec;
+}
+
+std::string
+partPath (const std::string &upload_dir, int part_number) {
+    return upload_dir + "/" + std::to_string (part_number);
+}
+
+} // namespace
+
+LocalFsS3Client::LocalFsS3Client (std::string root_dir,
+                                  std::shared_ptr<Aws::Utils::Threading::Executor> executor)
+    : root_dir_ (std::move (root_dir)),
+      executor_ (std::move (executor)) {
+    struct stat st;
+    if (stat (root_dir_.c_str(), &st) != 0 || !S_ISDIR (st.st_mode))
+        throw std::runtime_error ("Local object directory " + root_dir_ + " does not exist");
+}
+
+void
+LocalFsS3Client::setExecutor (std::shared_ptr<Aws::Utils::Threading::Executor> executor) {
+    executor_ = std::move (executor);
+}
+
+void
+LocalFsS3Client::submit (std::function<void()> task) {
+    if (executor_ && executor_->Submit (task)) return;
+    task();
+}
+
+std::string
+LocalFsS3Client::objectPath (std::string_view key) const {
+    // Keep the objects inside the root directory
+    std::filesystem::path key_path (key);
+    if (key.empty() || key_path.is_absolute()) return "";
+    for (const auto &component : key_path)
+        if (component == "..") return "";
+    return root_dir_ + "/" + std::string (key);
+}
+
+std::string
+LocalFsS3Client::uploadDir (std::string_view upload_id) const {
+    return root_dir_ + "/.multipart/" + std::string (upload_id);
+}
+
+void
+LocalFsS3Client::PutObjectAsync (std::string_view key,
+                                 uintptr_t data_ptr,
+                                 size_t data_len,
+                                 size_t offset,
+                                 PutObjectCallback callback) {
+    // Same semantics as S3, an object is written as a whole
+    std::string path = objectPath (key);
+    if (offset != 0 || path.empty()) {
+        callback (false);
+        return;
+    }
+
+    submit ([path, data_ptr, data_len, callback]() {
+        bool success = createParentDirs (path);
+        int fd = success ? open (path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) : -1;
+        if (fd < 0) {
+            NIXL_ERROR << "Failed to create object file " << path << ": " << strerror (errno);
+            callback (false);
+            return;
+        }
+
+        success = writeAll (fd, reinterpret_cast<const char *> (data_ptr), data_len, 0);
+        close (fd);
+        callback (success);
+    });
+}
+
+void
+LocalFsS3Client::GetObjectAsync (std::string_view key,
+                                 uintptr_t data_ptr,
+                                 size_t data_len,
+                                 size_t offset,
+                                 GetObjectCallback callback) {
+    std::string path = objectPath (key);
+    if (path.empty()) {
+        callback (false);
+        return;
+    }
+
+    submit ([path, data_ptr, data_len, offset, callback]() {
+        int fd = open (path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            NIXL_ERROR << "Failed to open object file " << path << ": " << strerror (errno);
+            callback (false);
+            return;
+        }
+
+        // Like a ranged GET, a range past the end of the object is truncated but a
+        // range starting past it fails
+        ssize_t ret = readAll (fd, reinterpret_cast<char *> (data_ptr), data_len, offset);
+        close (fd);
+        callback (ret > 0 || (ret == 0 && data_len == 0));
+    });
+}
+
+void
+LocalFsS3Client::CreateMultipartUploadAsync (std::string_view key,
+                                             CreateMultipartUploadCallback callback) {
+    if (objectPath (key).empty()) {
+        callback (false, std::string());
+        return;
+    }
+
+    // Unique across the processes sharing the directory
+    std::string upload_id = std::to_string (getpid()) + "-" + std::to_string (next_upload_id_++);
+    std::string dir = uploadDir (upload_id);
+
+    submit ([upload_id, dir, callback]() {
+        std::error_code ec;
+        std::filesystem::create_directories (dir, ec);
+        if (ec) {
+            NIXL_ERROR << "Failed to create multipart upload directory " << dir << ": "
+                       << ec.message();
+            callback (false, std::string());
+            return;
+        }
+        callback (true, upload_id);
+    });
+}
+
+void
+LocalFsS3Client::UploadPartAsync (std::string_view key,
+                                  std::string_view upload_id,
+                                  int part_number,
+                                  uintptr_t data_ptr,
+                                  size_t data_len,
+                                  UploadPartCallback callback) {
+    std::string path = partPath (uploadDir (upload_id), part_number);
+
+    submit ([path, data_ptr, data_len, callback]() {
+        int fd = open (path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            NIXL_ERROR << "Failed to create part file " << path << ": " << strerror (errno);
+            callback (false, std::string());
+            return;
+        }
+
+        // The ETag of a part is its size, completing the upload checks it
+        bool success = writeAll (fd, reinterpret_cast<const char *> (data_ptr), data_len, 0);
+        close (fd);
+        callback (success, success ? std::to_string (data_len) : std::string());
+    });
+}
+
+void
+LocalFsS3Client::CompleteMultipartUploadAsync (std::string_view key,
+                                               std::string_view upload_id,
+                                               const std::vector<std::string> &etags,
+                                               CompleteMultipartUploadCallback callback) {
+    std::string path = objectPath (key);
+    std::string dir = uploadDir (upload_id);
+
+    submit ([path, dir, etags, callback]() {
+        // Assemble the object next to the parts, then move it in place atomically
+        std::string tmp_path = dir + "/object";
+        int out_fd = open (tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        bool success = out_fd >= 0;
+
+        for (size_t i = 0; success && i < etags.size(); ++i) {
+            std::string part = partPath (dir, i + 1);
+            int in_fd = open (part.c_str(), O_RDONLY);
+            struct stat st;
+            success = in_fd >= 0 && fstat (in_fd, &st) == 0 &&
+                std::to_string (st.st_size) == etags[i] && appendFile (in_fd, out_fd, st.st_size);
+            if (in_fd >= 0) close (in_fd);
+        }
+
+        if (out_fd >= 0) close (out_fd);
+        success = success && createParentDirs (path) &&
+            rename (tmp_path.c_str(), path.c_str()) == 0;
+        if (!success) NIXL_ERROR << "Failed to complete the multipart upload of " << path;
+
+        std::error_code ec;
+        std::filesystem::remove_all (dir, ec);
+        callback (success);
+    });
+}
+
+void
+LocalFsS3Client::AbortMultipartUploadAsync (std::string_view key,
+                                            std::string_view upload_id,
+                                            AbortMultipartUploadCallback callback) {
+    std::string dir = uploadDir (upload_id);
+
+    submit ([dir, callback]() {
+        std::error_code ec;
+        std::filesystem::remove_all (dir, ec);
+        callback (!ec);
+    });
+}
+
+void
+LocalFsS3Client::DeleteObjectAsync (std::string_view key, DeleteObjectCallback callback) {
+    std::string path = objectPath (key);
+    if (path.empty()) {
+        callback (false);
+        return;
+    }
+
+    submit ([path, callback]() { callback (unlink (path.c_str()) == 0 || errno == ENOENT); });
+}
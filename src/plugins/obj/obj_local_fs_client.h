@@ -0,0 +1,97 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJ_LOCAL_FS_CLIENT_H
+#define OBJ_LOCAL_FS_CLIENT_H
+
+#include "obj_s3_client.h"
+#include <atomic>
+#include <string>
+
+/**
+ * IS3Client storing the objects as files of a local directory, named by object key.
+ * Requests run pread/pwrite on the same executor as the AWS client, so the OBJ data
+ * path can be measured without network or S3 latency.
+ */
+class LocalFsS3Client : public IS3Client {
+public:
+    /**
+     * @param root_dir Existing directory holding the objects
+     * @param executor Optional executor for async operations, requests run inline without it
+     */
+    LocalFsS3Client (std::string root_dir,
+                     std::shared_ptr<Aws::Utils::Threading::Executor> executor = nullptr);
+
+    void
+    setExecutor (std::shared_ptr<Aws::Utils::Threading::Executor> executor) override;
+
+    void
+    PutObjectAsync (std::string_view key,
+                    uintptr_t data_ptr,
+                    size_t data_len,
+                    size_t offset,
+                    PutObjectCallback callback) override;
+
+    void
+    GetObjectAsync (std::string_view key,
+                    uintptr_t data_ptr,
+                    size_t data_len,
+                    size_t offset,
+                    GetObjectCallback callback) override;
+
+    void
+    CreateMultipartUploadAsync (std::string_view key,
+                                CreateMultipartUploadCallback callback) override;
+
+    void
+    UploadPartAsync (std::string_view key,
+                     std::string_view upload_id,
+                     int part_number,
+                     uintptr_t data_ptr,
+                     size_t data_len,
+                     UploadPartCallback callback) override;
+
+    void
+    CompleteMultipartUploadAsync (std::string_view key,
+                                  std::string_view upload_id,
+                                  const std::vector<std::string> &etags,
+                                  CompleteMultipartUploadCallback callback) override;
+
+    void
+    AbortMultipartUploadAsync (std::string_view key,
+                               std::string_view upload_id,
+                               AbortMultipartUploadCallback callback) override;
+
+    void
+    DeleteObjectAsync (std::string_view key, DeleteObjectCallback callback) override;
+
+private:
+    void
+    submit (std::function<void()> task);
+
+    std::string
+    objectPath (std::string_view key) const;
+
+    std::string
+    uploadDir (std::string_view upload_id) const;
+
+    const std::string root_dir_;
+    std::shared_ptr<Aws::Utils::Threading::Executor> executor_;
+    std::atomic<uint64_t> next_upload_id_{0};
+};
+
+#endif // OBJ_LOCAL_FS_CLIENT_H
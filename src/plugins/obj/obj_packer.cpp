@@ -0,0 +1,622 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "obj_packer.h"
+#include "common/nixl_log.h"
+#include <absl/strings/str_format.h>
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <random>
+#include <tuple>
+
+struct nixlObjSegment {
+    std::string key;
+    size_t size = 0;
+    // Bytes referenced by the index, and GETs in flight
+    size_t live = 0;
+    size_t readers = 0;
+    bool candidate = false;
+    bool compacting = false;
+};
+
+struct nixlObjPendingSegment {
+    std::shared_ptr<nixlObjSegment> segment;
+    std::unique_ptr<char[]> data;
+    // Key, offset in the segment and length of every object
+    std::vector<std::tuple<std::string, size_t, size_t>> objects;
+    // Write sequence number of every object, empty for compacted segments
+    std::vector<uint64_t> seqs;
+};
+
+struct nixlObjCompaction {
+    std::vector<std::shared_ptr<nixlObjSegment>> victims;
+    std::vector<std::unique_ptr<char[]>> buffers;
+    // Victim and offset in it of every object of the new segment
+    std::vector<std::pair<size_t, size_t>> sources;
+    std::atomic<size_t> pending_reads{0};
+    std::atomic<bool> failed{false};
+};
+
+namespace {
+
+constexpr char indexMagic[] = "NIXLPAK1";
+constexpr size_t indexHeaderSize = 16;
+// Bound on the segment bytes read by one compaction, in segment sizes
+constexpr size_t maxCompactionRead = 4;
+
+std::string
+newSession() {
+    std::random_device rd;
+    return absl::StrFormat ("%08x%08x", rd(), rd());
+}
+
+void
+appendU64 (std::string &out, uint64_t value) {
+    out.append (reinterpret_cast<const char *> (&value), sizeof (value));
+}
+
+void
+appendString (std::string &out, const std::string &value) {
+    appendU64 (out, value.size());
+    out.append (value);
+}
+
+class indexReader {
+public:
+    explicit indexReader (const std::string &buffer) : buffer_ (buffer) {}
+
+    bool
+    readU64 (uint64_t &value) {
+        if (buffer_.size() - pos_ < sizeof (value)) return false;
+        std::memcpy (&value, buffer_.data() + pos_, sizeof (value));
+        pos_ += sizeof (value);
+        return true;
+    }
+
+    bool
+    readString (std::string &value) {
+        uint64_t len;
+        if (!readU64 (len) || buffer_.size() - pos_ < len) return false;
+        value.assign (buffer_, pos_, len);
+        pos_ += len;
+        return true;
+    }
+
+    bool
+    done() const {
+        return pos_ == buffer_.size();
+    }
+
+private:
+    const std::string &buffer_;
+    size_t pos_ = 0;
+};
+
+// Blocks until a GET or a PUT completes
+template<typename Op>
+bool
+waitFor (Op op) {
+    auto done = std::make_shared<std::promise<bool>>();
+    op ([done] (bool success) { done->set_value (success); });
+    return done->get_future().get();
+}
+
+} // namespace
+
+nixlObjPacker::nixlObjPacker (std::shared_ptr<IS3Client> s3_client, params params)
+    : s3_client_ (std::move (s3_client)),
+      params_ (std::move (params)),
+      session_ (newSession()) {}
+
+std::shared_ptr<nixlObjPendingSegment>
+nixlObjPacker::newSegment (size_t size) {
+    auto pending = std::make_shared<nixlObjPendingSegment>();
+    pending->segment = std::make_shared<nixlObjSegment>();
+    pending->segment->key =
+        absl::StrFormat ("%sseg-%s-%d", params_.prefix, session_, next_segment_++);
+    pending->segment->size = size;
+    pending->data = std::make_unique<char[]> (size);
+    return pending;
+}
+
+std::vector<std::shared_ptr<nixlObjPendingSegment>>
+nixlObjPacker::pack (const std::vector<write> &writes) {
+    std::vector<std::shared_ptr<nixlObjPendingSegment>> segments;
+    std::lock_guard<std::mutex> guard (lock_);
+
+    for (size_t i = 0; i < writes.size();) {
+        size_t end = i, size = 0;
+        while (end < writes.size() &&
+               (end == i || size + writes[end].len <= params_.segment_size))
+            size += writes[end++].len;
+
+        auto pending = newSegment (size);
+        for (size_t offset = 0; i < end; ++i) {
+            std::memcpy (pending->data.get() + offset,
+                         reinterpret_cast<const void *> (writes[i].data_ptr),
+                         writes[i].len);
+            pending->objects.emplace_back (*writes[i].key, offset, writes[i].len);
+            auto &key_writes = writes_[*writes[i].key];
+            key_writes.latest = ++next_write_;
+            ++key_writes.inflight;
+            pending->seqs.push_back (key_writes.latest);
+            offset += writes[i].len;
+        }
+        segments.push_back (std::move (pending));
+    }
+
+    return segments;
+}
+
+void
+nixlObjPacker::upload (std::shared_ptr<nixlObjPendingSegment> pending,
+                       nixlObjPackCallback callback) {
+    const auto &segment = pending->segment;
+    s3_client_->PutObjectAsync (
+        segment->key,
+        reinterpret_cast<uintptr_t> (pending->data.get()),
+        segment->size,
+        0,
+        [self = shared_from_this(), pending, callback] (bool success) {
+            // Index before completing, a read following the write must find the objects
+            if (success) {
+                self->indexSegment (pending);
+            } else {
+                NIXL_ERROR << "Failed to upload the packed segment " << pending->segment->key;
+                self->dropSegment (pending);
+            }
+            callback (success);
+        });
+}
+
+void
+nixlObjPacker::indexSegment (const std::shared_ptr<nixlObjPendingSegment> &pending) {
+    pending->data.reset();
+    {
+        std::lock_guard<std::mutex> guard (lock_);
+        const auto &segment = pending->segment;
+        segments_[segment->key] = segment;
+
+        for (size_t i = 0; i < pending->objects.size(); ++i) {
+            const auto &[key, offset, len] = pending->objects[i];
+            // A later write of the key already replaced this one
+            if (!retireWrite (key, pending->seqs[i])) continue;
+
+            auto &range = index_[key];
+            if (range.segment) unreference (range.segment, range.len);
+            range = {segment, offset, len};
+            segment->live += len;
+        }
+
+        retireIfDead (segment);
+    }
+
+    deleteDeadSegments();
+    maybeCompact();
+}
+
+void
+nixlObjPacker::dropSegment (const std::shared_ptr<nixlObjPendingSegment> &pending) {
+    pending->data.reset();
+    std::lock_guard<std::mutex> guard (lock_);
+    for (size_t i = 0; i < pending->objects.size(); ++i)
+        retireWrite (std::get<0> (pending->objects[i]), pending->seqs[i]);
+}
+
+bool
+nixlObjPacker::retireWrite (const std::string &key, uint64_t seq) {
+    auto it = writes_.find (key);
+    const bool latest = it->second.latest == seq;
+    if (--it->second.inflight == 0) writes_.erase (it);
+    return latest;
+}
+
+nixl_status_t
+nixlObjPacker::lookup (const std::string &key,
+                       size_t offset,
+                       size_t len,
+                       nixlObjPackedRange &range) {
+    std::lock_guard<std::mutex> guard (lock_);
+    auto it = index_.find (key);
+    if (it == index_.end()) return NIXL_ERR_NOT_FOUND;
+
+    const auto &packed = it->second;
+    if (offset > packed.len || len > packed.len - offset) {
+        NIXL_ERROR << absl::StrFormat (
+            "Error: Read of %d bytes at offset %d is past the end of the %d bytes packed "
+            "object %s",
+            len,
+            offset,
+            packed.len,
+            key);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    range = {packed.segment, packed.offset + offset, len};
+    ++packed.segment->readers;
+    return NIXL_SUCCESS;
+}
+
+void
+nixlObjPacker::read (const nixlObjPackedRange &range,
+                     uintptr_t data_ptr,
+                     nixlObjPackCallback callback) {
+    s3_client_->GetObjectAsync (
+        range.segment->key,
+        data_ptr,
+        range.len,
+        range.offset,
+        [self = shared_from_this(), range, callback] (bool success) {
+            self->release (range);
+            callback (success);
+        });
+}
+
+void
+nixlObjPacker::release (const nixlObjPackedRange &range) {
+    {
+        std::lock_guard<std::mutex> guard (lock_);
+        --range.segment->readers;
+        retireIfDead (range.segment);
+    }
+
+    deleteDeadSegments();
+}
+
+void
+nixlObjPacker::invalidate (const std::string &key) {
+    {
+        std::lock_guard<std::mutex> guard (lock_);
+        // Packed writes of the key still uploading are older than this one
+        auto writes = writes_.find (key);
+        if (writes != writes_.end()) writes->second.latest = ++next_write_;
+
+        auto it = index_.find (key);
+        if (it == index_.end()) return;
+
+        unreference (it->second.segment, it->second.len);
+        index_.erase (it);
+    }
+
+    deleteDeadSegments();
+    maybeCompact();
+}
+
+void
+nixlObjPacker::unreference (const std::shared_ptr<nixlObjSegment> &segment, size_t len) {
+    segment->live -= len;
+    retireIfDead (segment);
+
+    if (!segment->candidate && !segment->compacting && segment->live > 0 &&
+        segment->live < params_.compact_ratio * segment->size) {
+        segment->candidate = true;
+        candidates_.push_back (segment);
+    }
+}
+
+void
+nixlObjPacker::retireIfDead (const std::shared_ptr<nixlObjSegment> &segment) {
+    if (segment->live == 0 && segment->readers == 0 && !segment->compacting &&
+        segments_.erase (segment->key))
+        dead_.push_back (segment);
+}
+
+void
+nixlObjPacker::deleteDeadSegments() {
+    std::vector<std::shared_ptr<nixlObjSegment>> dead;
+    {
+        std::lock_guard<std::mutex> guard (lock_);
+        dead.swap (dead_);
+    }
+
+    for (const auto &segment : dead)
+        s3_client_->DeleteObjectAsync (segment->key, [key = segment->key] (bool success) {
+            if (!success) NIXL_WARN << "Failed to delete the dead packed segment " << key;
+        });
+}
+
+void
+nixlObjPacker::maybeCompact() {
+    auto compaction = std::make_shared<nixlObjCompaction>();
+    {
+        std::lock_guard<std::mutex> guard (lock_);
+        if (compacting_ || closing_) return;
+
+        // Drop the candidates emptied since, they are deleted once their reads complete
+        candidates_.erase (std::remove_if (candidates_.begin(),
+                                           candidates_.end(),
+                                           [] (const std::shared_ptr<nixlObjSegment> &segment) {
+                                               if (segment->live > 0) return false;
+                                               segment->candidate = false;
+                                               return true;
+                                           }),
+                           candidates_.end());
+
+        // Wait for a segment worth of dead bytes, so a GET and a PUT reclaim enough
+        size_t dead = 0;
+        for (const auto &segment : candidates_)
+            dead += segment->size - segment->live;
+        if (dead < params_.segment_size) return;
+
+        // The live ranges of the victims must fit in one new segment
+        size_t live = 0, size = 0;
+        for (auto it = candidates_.begin(); it != candidates_.end();) {
+            const auto &segment = *it;
+            if (!compaction->victims.empty() &&
+                (live + segment->live > params_.segment_size ||
+                 size + segment->size > maxCompactionRead * params_.segment_size)) {
+                ++it;
+                continue;
+            }
+
+            live += segment->live;
+            size += segment->size;
+            segment->candidate = false;
+            segment->compacting = true;
+            compaction->victims.push_back (segment);
+            it = candidates_.erase (it);
+        }
+
+        compacting_ = true;
+    }
+
+    NIXL_DEBUG << "Compacting " << compaction->victims.size() << " packed segments";
+
+    const size_t count = compaction->victims.size();
+    compaction->pending_reads = count;
+    for (size_t i = 0; i < count; ++i) {
+        const auto &segment = compaction->victims[i];
+        compaction->buffers.push_back (std::make_unique<char[]> (segment->size));
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const auto &segment = compaction->victims[i];
+        s3_client_->GetObjectAsync (
+            segment->key,
+            reinterpret_cast<uintptr_t> (compaction->buffers[i].get()),
+            segment->size,
+            0,
+            [self = shared_from_this(), compaction] (bool success) {
+                if (!success) compaction->failed = true;
+                if (--compaction->pending_reads == 0) self->rewriteSegments (compaction);
+            });
+    }
+}
+
+void
+nixlObjPacker::rewriteSegments (std::shared_ptr<nixlObjCompaction> compaction) {
+    if (compaction->failed) {
+        NIXL_WARN << "Failed to read the packed segments to compact";
+        finishCompaction (compaction);
+        return;
+    }
+
+    // Live objects of the victims. Compactions are rare, scanning the whole index is
+    // cheaper than tracking the objects of every segment.
+    std::vector<std::tuple<std::string, size_t, size_t>> objects;
+    size_t size = 0;
+    {
+        std::lock_guard<std::mutex> guard (lock_);
+        for (const auto &[key, range] : index_) {
+            auto victim = std::find (
+                compaction->victims.begin(), compaction->victims.end(), range.segment);
+            if (victim == compaction->victims.end()) continue;
+            objects.emplace_back (key, range.offset, range.len);
+            compaction->sources.emplace_back (victim - compaction->victims.begin(), range.offset);
+            size += range.len;
+        }
+    }
+
+    if (objects.empty()) {
+        finishCompaction (compaction);
+        return;
+    }
+
+    // The victims are immutable, copy their live ranges without the lock
+    auto pending = newSegment (size);
+    size_t offset = 0;
+    for (size_t i = 0; i < objects.size(); ++i) {
+        auto &[key, victim_offset, len] = objects[i];
+        std::memcpy (pending->data.get() + offset,
+                     compaction->buffers[compaction->sources[i].first].get() + victim_offset,
+                     len);
+        pending->objects.emplace_back (std::move (key), offset, len);
+        offset += len;
+    }
+    compaction->buffers.clear();
+
+    s3_client_->PutObjectAsync (
+        pending->segment->key,
+        reinterpret_cast<uintptr_t> (pending->data.get()),
+        size,
+        0,
+        [self = shared_from_this(), compaction, pending] (bool success) {
+            if (success)
+                self->indexCompactedSegment (compaction, pending);
+            else
+                NIXL_WARN << "Failed to upload the compacted segment " << pending->segment->key;
+            self->finishCompaction (compaction);
+        });
+}
+
+void
+nixlObjPacker::indexCompactedSegment (const std::shared_ptr<nixlObjCompaction> &compaction,
+                                      const std::shared_ptr<nixlObjPendingSegment> &pending) {
+    pending->data.reset();
+    std::lock_guard<std::mutex> guard (lock_);
+    const auto &segment = pending->segment;
+    segments_[segment->key] = segment;
+
+    for (size_t i = 0; i < pending->objects.size(); ++i) {
+        const auto &[key, offset, len] = pending->objects[i];
+        const auto &[victim, victim_offset] = compaction->sources[i];
+
+        // Objects rewritten during the compaction stay where they were written
+        auto it = index_.find (key);
+        if (it == index_.end() || it->second.segment != compaction->victims[victim] ||
+            it->second.offset != victim_offset)
+            continue;
+
+        it->second.segment->live -= len;
+        it->second = {segment, offset, len};
+        segment->live += len;
+    }
+
+    retireIfDead (segment);
+}
+
+void
+nixlObjPacker::finishCompaction (const std::shared_ptr<nixlObjCompaction> &compaction) {
+    {
+        std::lock_guard<std::mutex> guard (lock_);
+        for (const auto &segment : compaction->victims) {
+            segment->compacting = false;
+            retireIfDead (segment);
+        }
+        compacting_ = false;
+    }
+    idle_.notify_all();
+
+    deleteDeadSegments();
+    maybeCompact();
+}
+
+std::string
+nixlObjPacker::serializeIndex() const {
+    std::string body;
+    std::unordered_map<const nixlObjSegment *, uint64_t> segment_ids;
+
+    appendU64 (body, segments_.size());
+    for (const auto &[key, segment] : segments_) {
+        segment_ids.emplace (segment.get(), segment_ids.size());
+        appendString (body, key);
+        appendU64 (body, segment->size);
+    }
+
+    appendU64 (body, index_.size());
+    for (const auto &[key, range] : index_) {
+        appendString (body, key);
+        appendU64 (body, segment_ids.at (range.segment.get()));
+        appendU64 (body, range.offset);
+        appendU64 (body, range.len);
+    }
+
+    return body;
+}
+
+bool
+nixlObjPacker::deserializeIndex (const std::string &body) {
+    indexReader reader (body);
+    std::vector<std::shared_ptr<nixlObjSegment>> segments;
+
+    uint64_t count;
+    if (!reader.readU64 (count)) return false;
+    for (uint64_t i = 0; i < count; ++i) {
+        auto segment = std::make_shared<nixlObjSegment>();
+        uint64_t size;
+        if (!reader.readString (segment->key) || !reader.readU64 (size)) return false;
+        segment->size = size;
+        segments.push_back (std::move (segment));
+    }
+
+    std::unordered_map<std::string, nixlObjPackedRange> index;
+    if (!reader.readU64 (count)) return false;
+    for (uint64_t i = 0; i < count; ++i) {
+        std::string key;
+        uint64_t id, offset, len;
+        if (!reader.readString (key) || !reader.readU64 (id) || !reader.readU64 (offset) ||
+            !reader.readU64 (len) || id >= segments.size() || offset > segments[id]->size ||
+            len > segments[id]->size - offset)
+            return false;
+        segments[id]->live += len;
+        index[key] = {segments[id], offset, len};
+    }
+    if (!reader.done()) return false;
+
+    std::lock_guard<std::mutex> guard (lock_);
+    index_ = std::move (index);
+    for (const auto &segment : segments) {
+        segments_[segment->key] = segment;
+        unreference (segment, 0);
+    }
+    return true;
+}
+
+void
+nixlObjPacker::loadIndex() {
+    if (!params_.persist_index) return;
+
+    const std::string key = indexKey();
+    char header[indexHeaderSize];
+    if (!waitFor ([&] (nixlObjPackCallback callback) {
+            s3_client_->GetObjectAsync (
+                key, reinterpret_cast<uintptr_t> (header), sizeof (header), 0, callback);
+        })) {
+        NIXL_INFO << "No packed object index " << key << ", starting with an empty one";
+        return;
+    }
+
+    uint64_t body_len;
+    std::memcpy (&body_len, header + sizeof (indexMagic) - 1, sizeof (body_len));
+    std::string body;
+    bool success = std::memcmp (header, indexMagic, sizeof (indexMagic) - 1) == 0;
+    if (success) {
+        body.resize (body_len);
+        success = waitFor ([&] (nixlObjPackCallback callback) {
+            s3_client_->GetObjectAsync (key,
+                                        reinterpret_cast<uintptr_t> (body.data()),
+                                        body.size(),
+                                        indexHeaderSize,
+                                        callback);
+        });
+    }
+
+    if (!success || !deserializeIndex (body)) {
+        NIXL_ERROR << "Failed to load the packed object index " << key
+                   << ", starting with an empty one";
+        return;
+    }
+
+    NIXL_INFO << absl::StrFormat ("Loaded %d packed objects in %d segments from %s",
+                                  index_.size(),
+                                  segments_.size(),
+                                  key);
+    deleteDeadSegments();
+}
+
+void
+nixlObjPacker::close() {
+    std::string object (indexMagic, sizeof (indexMagic) - 1);
+    {
+        std::unique_lock<std::mutex> guard (lock_);
+        closing_ = true;
+        idle_.wait (guard, [this] { return !compacting_; });
+        if (!params_.persist_index) return;
+
+        std::string body = serializeIndex();
+        appendU64 (object, body.size());
+        object += body;
+    }
+
+    const std::string key = indexKey();
+    if (!waitFor ([&] (nixlObjPackCallback callback) {
+            s3_client_->PutObjectAsync (
+                key, reinterpret_cast<uintptr_t> (object.data()), object.size(), 0, callback);
+        }))
+        NIXL_ERROR << "Failed to save the packed object index " << key;
+}
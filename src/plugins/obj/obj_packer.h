@@ -0,0 +1,199 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJ_PACKER_H
+#define OBJ_PACKER_H
+
+#include "obj_s3_client.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using nixlObjPackCallback = std::function<void (bool success)>;
+
+// Object packed into a segment, nullptr segment when it isn't packed
+struct nixlObjSegment;
+
+struct nixlObjPackedRange {
+    std::shared_ptr<nixlObjSegment> segment;
+    size_t offset = 0;
+    size_t len = 0;
+};
+
+// Small objects staged into one segment object, indexed once the segment is uploaded
+struct nixlObjPendingSegment;
+struct nixlObjCompaction;
+
+/**
+ * Packs small objects into larger segment objects, so that writing many small
+ * objects costs one PUT per segment instead of one per object. An in-memory index
+ * maps every packed object key to its range in a segment, reads are ranged GETs
+ * of the segment. Objects rewritten or replaced by unpacked writes leave dead
+ * ranges behind, segments mostly dead are compacted by copying their live ranges
+ * into a new segment. The index can be saved as an object to be reused by the
+ * next engine with the same prefix.
+ */
+class nixlObjPacker : public std::enable_shared_from_this<nixlObjPacker> {
+public:
+    struct params {
+        // Largest object packed, larger ones are written as their own object
+        size_t max_object_size;
+        size_t segment_size;
+        // Segments whose live share drops below this ratio are compacted
+        double compact_ratio;
+        // Prefix of the segment and index object keys
+        std::string prefix;
+        bool persist_index;
+    };
+
+    struct write {
+        const std::string *key;
+        uintptr_t data_ptr;
+        size_t len;
+    };
+
+    nixlObjPacker (std::shared_ptr<IS3Client> s3_client, params params);
+
+    bool
+    shouldPack (size_t len) const {
+        return len > 0 && len <= params_.max_object_size;
+    }
+
+    /**
+     * Copies the objects into segments of up to the segment size, each to be
+     * uploaded by upload().
+     */
+    std::vector<std::shared_ptr<nixlObjPendingSegment>>
+    pack (const std::vector<write> &writes);
+
+    /**
+     * Uploads a segment and indexes its objects, the callback runs once after it.
+     */
+    void
+    upload (std::shared_ptr<nixlObjPendingSegment> segment, nixlObjPackCallback callback);
+
+    /**
+     * Looks up the range of len bytes at offset in a packed object. On success the
+     * segment is pinned until read() completes or release() is called.
+     * @return NIXL_ERR_NOT_FOUND if the object isn't packed, NIXL_ERR_INVALID_PARAM
+     *         if the range is past its end
+     */
+    nixl_status_t
+    lookup (const std::string &key, size_t offset, size_t len, nixlObjPackedRange &range);
+
+    void
+    read (const nixlObjPackedRange &range, uintptr_t data_ptr, nixlObjPackCallback callback);
+
+    void
+    release (const nixlObjPackedRange &range);
+
+    /**
+     * Drops a packed object from the index, when it is written as its own object.
+     */
+    void
+    invalidate (const std::string &key);
+
+    // Loads the index saved by close(), blocks until done
+    void
+    loadIndex();
+
+    // Waits for the compaction in flight and saves the index if it is persistent
+    void
+    close();
+
+private:
+    std::shared_ptr<nixlObjPendingSegment>
+    newSegment (size_t size);
+
+    void
+    indexSegment (const std::shared_ptr<nixlObjPendingSegment> &pending);
+
+    // Forgets the writes of a segment whose upload failed
+    void
+    dropSegment (const std::shared_ptr<nixlObjPendingSegment> &pending);
+
+    void
+    deleteDeadSegments();
+
+    void
+    maybeCompact();
+
+    void
+    rewriteSegments (std::shared_ptr<nixlObjCompaction> compaction);
+
+    void
+    indexCompactedSegment (const std::shared_ptr<nixlObjCompaction> &compaction,
+                           const std::shared_ptr<nixlObjPendingSegment> &pending);
+
+    void
+    finishCompaction (const std::shared_ptr<nixlObjCompaction> &compaction);
+
+    // The methods below expect the lock to be held
+    bool
+    retireWrite (const std::string &key, uint64_t seq);
+
+    void
+    unreference (const std::shared_ptr<nixlObjSegment> &segment, size_t len);
+
+    void
+    retireIfDead (const std::shared_ptr<nixlObjSegment> &segment);
+
+    std::string
+    serializeIndex() const;
+
+    bool
+    deserializeIndex (const std::string &body);
+
+    std::string
+    indexKey() const {
+        return params_.prefix + "index";
+    }
+
+    const std::shared_ptr<IS3Client> s3_client_;
+    const params params_;
+    // Unique among the engines sharing the prefix, segment keys are never reused
+    const std::string session_;
+
+    std::atomic<uint64_t> next_segment_{0};
+
+    std::mutex lock_;
+    std::condition_variable idle_;
+    std::unordered_map<std::string, nixlObjPackedRange> index_;
+    // Latest write of every key with packed writes in flight, and the count of them.
+    // Uploads complete in any order, only the latest write of a key gets indexed.
+    struct keyWrites {
+        uint64_t latest = 0;
+        size_t inflight = 0;
+    };
+    std::unordered_map<std::string, keyWrites> writes_;
+    uint64_t next_write_ = 0;
+    std::unordered_map<std::string, std::shared_ptr<nixlObjSegment>> segments_;
+    // Segments below the compaction ratio
+    std::vector<std::shared_ptr<nixlObjSegment>> candidates_;
+    // Segments without live ranges nor reads in flight, to be deleted
+    std::vector<std::shared_ptr<nixlObjSegment>> dead_;
+    bool compacting_ = false;
+    bool closing_ = false;
+};
+
+#endif // OBJ_PACKER_H
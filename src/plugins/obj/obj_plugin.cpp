@@ -54,6 +54,18 @@ get_backend_options() {
     params["access_key"] = "AWS access key ID (required)";
     params["secret_key"] = "AWS secret access key (required)";
     params["session_token"] = "AWS session token (optional)";
+    params["multipart_part_size"] = "Part size in bytes for multipart uploads (optional)";
+    params["multipart_concurrency"] = "Parts of one object uploaded concurrently (optional)";
+    params["read_chunk_size"] = "Ranged GET size in bytes for large reads, or auto (optional)";
+    params["local_dir"] = "Store the objects as files of this directory instead of S3 (optional)";
+    params["read_concurrency"] = "Ranged GETs of one descriptor issued concurrently (optional)";
+    params["pack_max_size"] = "Pack objects up to this size into segment objects, 0 disables "
+                              "(optional)";
+    params["pack_segment_size"] = "Size of the segment objects small objects are packed into "
+                                  "(optional)";
+    params["pack_compact_ratio"] = "Live share below which a segment is compacted (optional)";
+    params["pack_prefix"] = "Key prefix of the segment objects and packing index (optional)";
+    params["pack_index"] = "Save and reload the packing index, true/false (optional)";
     return params;
 }
 
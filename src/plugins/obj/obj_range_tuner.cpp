@@ -0,0 +1,79 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "obj_range_tuner.h"
+#include <algorithm>
+#include <cmath>
+
+nixlObjRangeTuner::nixlObjRangeTuner (size_t initial_chunk_size,
+                                      size_t min_chunk_size,
+                                      size_t max_chunk_size)
+    : min_chunk_size_ (min_chunk_size),
+      max_chunk_size_ (max_chunk_size),
+      chunk_size_ (std::clamp (initial_chunk_size, min_chunk_size, max_chunk_size)) {}
+
+size_t
+nixlObjRangeTuner::getChunkSize() const {
+    std::lock_guard<std::mutex> guard (lock_);
+    return chunk_size_;
+}
+
+bool
+nixlObjRangeTuner::canFit() const {
+    // The relative variance of the sizes must be large enough for a stable slope
+    const double det = w_ * ss_ - s_ * s_;
+    return det > 0.01 * w_ * ss_;
+}
+
+bool
+nixlObjRangeTuner::needsProbe() const {
+    std::lock_guard<std::mutex> guard (lock_);
+    return !canFit();
+}
+
+void
+nixlObjRangeTuner::record (size_t bytes, std::chrono::microseconds duration) {
+    const double s = bytes;
+    const double d = duration.count();
+    std::lock_guard<std::mutex> guard (lock_);
+
+    w_ = w_ * decay + 1;
+    s_ = s_ * decay + s;
+    d_ = d_ * decay + d;
+    ss_ = ss_ * decay + s * s;
+    sd_ = sd_ * decay + s * d;
+
+    if (!canFit()) return;
+
+    const double inv_bw = (w_ * sd_ - s_ * d_) / (w_ * ss_ - s_ * s_);
+    const double latency = (d_ - inv_bw * s_) / w_;
+
+    // Noise can make one of the terms negative, a request is then bound by the
+    // other one alone
+    double target;
+    if (latency <= 0)
+        target = min_chunk_size_;
+    else if (inv_bw <= 0)
+        target = max_chunk_size_;
+    else
+        target = latency / inv_bw * (1 - targetLatencyShare) / targetLatencyShare;
+
+    // Round to MiB so small fluctuations don't change the chunk size
+    const size_t mib = 1024 * 1024;
+    size_t chunk_size = std::llround (std::min (target, double (max_chunk_size_)) / mib) * mib;
+    chunk_size_ = std::clamp (chunk_size, min_chunk_size_, max_chunk_size_);
+}
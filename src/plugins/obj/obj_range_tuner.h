@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef OBJ_RANGE_TUNER_H
+#define OBJ_RANGE_TUNER_H
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+/**
+ * Chunk size of the ranged GETs a large read is split into, learned from the
+ * completed requests. Samples are fitted to duration = latency + bytes / bandwidth
+ * and the chunk size is chosen so that the latency is about a tenth of a request.
+ * Older samples decay exponentially so the size follows the endpoint.
+ */
+class nixlObjRangeTuner {
+public:
+    nixlObjRangeTuner (size_t initial_chunk_size, size_t min_chunk_size, size_t max_chunk_size);
+
+    size_t
+    getChunkSize() const;
+
+    /**
+     * True while the samples are too uniform in size to separate latency from
+     * bandwidth, the caller should then issue some requests of another size.
+     */
+    bool
+    needsProbe() const;
+
+    void
+    record (size_t bytes, std::chrono::microseconds duration);
+
+private:
+    // Latency over request duration the chunk size is chosen for
+    static constexpr double targetLatencyShare = 0.1;
+    static constexpr double decay = 0.95;
+
+    const size_t min_chunk_size_;
+    const size_t max_chunk_size_;
+
+    mutable std::mutex lock_;
+    size_t chunk_size_;
+    // Exponentially decayed sums for least squares, s is the size in bytes and d
+    // the duration in us
+    double w_ = 0, s_ = 0, d_ = 0, ss_ = 0, sd_ = 0;
+
+    bool
+    canFit() const;
+};
+
+#endif // OBJ_RANGE_TUNER_H
@@ -24,6 +24,13 @@
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/PutObjectResult.h>
 #include <aws/s3/model/GetObjectResult.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CompletedMultipartUpload.h>
+#include <aws/s3/model/CompletedPart.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/DeleteObjectRequest.h>
 #include <aws/core/http/Scheme.h>
 #include <aws/core/auth/AWSCredentials.h>
 #include <aws/core/client/ClientConfiguration.h>
@@ -220,3 +227,122 @@ AwsS3Client::GetObjectAsync (std::string_view key,
         },
         nullptr);
 }
+
+void
+AwsS3Client::CreateMultipartUploadAsync (std::string_view key,
+                                         CreateMultipartUploadCallback callback) {
+    Aws::S3::Model::CreateMultipartUploadRequest request;
+    request.WithBucket (bucket_name_).WithKey (Aws::String (key));
+
+    s3_client_->CreateMultipartUploadAsync (
+        request,
+        [callback] (const Aws::S3::S3Client *client,
+                    const Aws::S3::Model::CreateMultipartUploadRequest &req,
+                    const Aws::S3::Model::CreateMultipartUploadOutcome &outcome,
+                    const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            if (outcome.IsSuccess())
+                callback (true, std::string (outcome.GetResult().GetUploadId()));
+            else
+                callback (false, std::string());
+        },
+        nullptr);
+}
+
+void
+AwsS3Client::UploadPartAsync (std::string_view key,
+                              std::string_view upload_id,
+                              int part_number,
+                              uintptr_t data_ptr,
+                              size_t data_len,
+                              UploadPartCallback callback) {
+    Aws::S3::Model::UploadPartRequest request;
+    request.WithBucket (bucket_name_)
+        .WithKey (Aws::String (key))
+        .WithUploadId (Aws::String (upload_id))
+        .WithPartNumber (part_number)
+        .WithContentLength (data_len);
+
+    auto preallocated_stream_buf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedStreamBuf> (
+        "UploadPartStreamBuf", reinterpret_cast<unsigned char *> (data_ptr), data_len);
+    auto data_stream =
+        Aws::MakeShared<Aws::IOStream> ("UploadPartInputStream", preallocated_stream_buf.get());
+    request.SetBody (data_stream);
+
+    s3_client_->UploadPartAsync (
+        request,
+        [callback, preallocated_stream_buf, data_stream] (
+            const Aws::S3::S3Client *client,
+            const Aws::S3::Model::UploadPartRequest &req,
+            const Aws::S3::Model::UploadPartOutcome &outcome,
+            const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            if (outcome.IsSuccess())
+                callback (true, std::string (outcome.GetResult().GetETag()));
+            else
+                callback (false, std::string());
+        },
+        nullptr);
+}
+
+void
+AwsS3Client::CompleteMultipartUploadAsync (std::string_view key,
+                                           std::string_view upload_id,
+                                           const std::vector<std::string> &etags,
+                                           CompleteMultipartUploadCallback callback) {
+    Aws::S3::Model::CompletedMultipartUpload completed_upload;
+    for (size_t i = 0; i < etags.size(); ++i)
+        completed_upload.AddParts (Aws::S3::Model::CompletedPart()
+                                       .WithETag (Aws::String (etags[i]))
+                                       .WithPartNumber (static_cast<int> (i + 1)));
+
+    Aws::S3::Model::CompleteMultipartUploadRequest request;
+    request.WithBucket (bucket_name_)
+        .WithKey (Aws::String (key))
+        .WithUploadId (Aws::String (upload_id))
+        .WithMultipartUpload (completed_upload);
+
+    s3_client_->CompleteMultipartUploadAsync (
+        request,
+        [callback] (const Aws::S3::S3Client *client,
+                    const Aws::S3::Model::CompleteMultipartUploadRequest &req,
+                    const Aws::S3::Model::CompleteMultipartUploadOutcome &outcome,
+                    const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            callback (outcome.IsSuccess());
+        },
+        nullptr);
+}
+
+void
+AwsS3Client::AbortMultipartUploadAsync (std::string_view key,
+                                        std::string_view upload_id,
+                                        AbortMultipartUploadCallback callback) {
+    Aws::S3::Model::AbortMultipartUploadRequest request;
+    request.WithBucket (bucket_name_)
+        .WithKey (Aws::String (key))
+        .WithUploadId (Aws::String (upload_id));
+
+    s3_client_->AbortMultipartUploadAsync (
+        request,
+        [callback] (const Aws::S3::S3Client *client,
+                    const Aws::S3::Model::AbortMultipartUploadRequest &req,
+                    const Aws::S3::Model::AbortMultipartUploadOutcome &outcome,
+                    const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            callback (outcome.IsSuccess());
+        },
+        nullptr);
+}
+
+void
+AwsS3Client::DeleteObjectAsync (std::string_view key, DeleteObjectCallback callback) {
+    Aws::S3::Model::DeleteObjectRequest request;
+    request.WithBucket (bucket_name_).WithKey (Aws::String (key));
+
+    s3_client_->DeleteObjectAsync (
+        request,
+        [callback] (const Aws::S3::S3Client *client,
+                    const Aws::S3::Model::DeleteObjectRequest &req,
+                    const Aws::S3::Model::DeleteObjectOutcome &outcome,
+                    const std::shared_ptr<const Aws::Client::AsyncCallerContext> &context) {
+            callback (outcome.IsSuccess());
+        },
+        nullptr);
+}
@@ -22,6 +22,8 @@
 #include <memory>
 #include <string_view>
 #include <cstdint>
+#include <string>
+#include <vector>
 #include <aws/s3/S3Client.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 #include <aws/core/Aws.h>
@@ -29,10 +31,17 @@
 
 using PutObjectCallback = std::function<void (bool success)>;
 using GetObjectCallback = std::function<void (bool success)>;
+using CreateMultipartUploadCallback =
+    std::function<void (bool success, const std::string &upload_id)>;
+using UploadPartCallback = std::function<void (bool success, const std::string &etag)>;
+using CompleteMultipartUploadCallback = std::function<void (bool success)>;
+using AbortMultipartUploadCallback = std::function<void (bool success)>;
+using DeleteObjectCallback = std::function<void (bool success)>;
 
 /**
  * Abstract interface for S3 client operations.
- * Provides async operations for PutObject and GetObject.
+ * Provides async operations for PutObject, GetObject and DeleteObject, and
+ * for the multipart upload of large objects.
  */
 class IS3Client {
 public:
@@ -74,6 +83,63 @@ public:
                     size_t data_len,
                     size_t offset,
                     GetObjectCallback callback) = 0;
+
+    /**
+     * Asynchronously start a multipart upload.
+     * @param key The object key
+     * @param callback Callback function receiving the upload ID
+     */
+    virtual void
+    CreateMultipartUploadAsync (std::string_view key, CreateMultipartUploadCallback callback) = 0;
+
+    /**
+     * Asynchronously upload one part of a multipart upload.
+     * @param key The object key
+     * @param upload_id The upload ID returned by CreateMultipartUploadAsync
+     * @param part_number The 1-based part number, parts are ordered by it
+     * @param data_ptr Pointer to the part data
+     * @param data_len Length of the part in bytes
+     * @param callback Callback function receiving the part ETag
+     */
+    virtual void
+    UploadPartAsync (std::string_view key,
+                     std::string_view upload_id,
+                     int part_number,
+                     uintptr_t data_ptr,
+                     size_t data_len,
+                     UploadPartCallback callback) = 0;
+
+    /**
+     * Asynchronously complete a multipart upload.
+     * @param key The object key
+     * @param upload_id The upload ID returned by CreateMultipartUploadAsync
+     * @param etags The ETags of all the parts, indexed by part number - 1
+     * @param callback Callback function to handle the result
+     */
+    virtual void
+    CompleteMultipartUploadAsync (std::string_view key,
+                                  std::string_view upload_id,
+                                  const std::vector<std::string> &etags,
+                                  CompleteMultipartUploadCallback callback) = 0;
+
+    /**
+     * Asynchronously abort a multipart upload and discard its parts.
+     * @param key The object key
+     * @param upload_id The upload ID returned by CreateMultipartUploadAsync
+     * @param callback Callback function to handle the result
+     */
+    virtual void
+    AbortMultipartUploadAsync (std::string_view key,
+                               std::string_view upload_id,
+                               AbortMultipartUploadCallback callback) = 0;
+
+    /**
+     * Asynchronously delete an object, deleting a missing object succeeds.
+     * @param key The object key
+     * @param callback Callback function to handle the result
+     */
+    virtual void
+    DeleteObjectAsync (std::string_view key, DeleteObjectCallback callback) = 0;
 };
 
 /**
@@ -106,6 +172,32 @@ public:
                     size_t offset,
                     GetObjectCallback callback) override;
 
+    void
+    CreateMultipartUploadAsync (std::string_view key,
+                                CreateMultipartUploadCallback callback) override;
+
+    void
+    UploadPartAsync (std::string_view key,
+                     std::string_view upload_id,
+                     int part_number,
+                     uintptr_t data_ptr,
+                     size_t data_len,
+                     UploadPartCallback callback) override;
+
+    void
+    CompleteMultipartUploadAsync (std::string_view key,
+                                  std::string_view upload_id,
+                                  const std::vector<std::string> &etags,
+                                  CompleteMultipartUploadCallback callback) override;
+
+    void
+    AbortMultipartUploadAsync (std::string_view key,
+                               std::string_view upload_id,
+                               AbortMultipartUploadCallback callback) override;
+
+    void
+    DeleteObjectAsync (std::string_view key, DeleteObjectCallback callback) override;
+
 private:
     std::unique_ptr<Aws::SDKOptions, std::function<void (Aws::SDKOptions *)>> aws_options_;
     std::unique_ptr<Aws::S3::S3Client> s3_client_;
@@ -21,15 +21,23 @@
 #include "common/nixl_log.h"
 #include <string.h>
 #include <time.h>
+#include <algorithm>
 #include <stdexcept>
 
-aioQueue::aioQueue(int num_entries, nixl_xfer_op_t operation)
-    : aiocbs(num_entries), num_entries(num_entries), num_completed(0), num_submitted(0), operation(operation) {
-    if (num_entries <= 0) {
+aioQueue::aioQueue(int num_entries, int max_inflight, nixl_xfer_op_t operation)
+    : aiocbs(std::min(num_entries, max_inflight))
+    , num_entries(num_entries)
+    , num_completed(0)
+    , num_submitted(0)
+    , operation(operation)
+    , local(nullptr)
+    , remote(nullptr) {
+    if (num_entries <= 0 || max_inflight <= 0) {
         throw std::runtime_error("Invalid number of entries for AIO queue");
     }
-    for (auto& aiocb : aiocbs) {
-        memset(&aiocb, 0, sizeof(struct aiocb));
+    for (size_t i = 0; i < aiocbs.size(); i++) {
+        memset(&aiocbs[i], 0, sizeof(struct aiocb));
+        free_slots.push_back(i);
     }
 }
 
@@ -41,23 +49,22 @@ aioQueue::~aioQueue() {
 
     // Cancel any remaining I/Os
     for (auto& aiocb : aiocbs) {
-        if (aiocb.aio_fildes != 0) {
+        if (aiocb.aio_nbytes != 0) {
             aio_cancel(aiocb.aio_fildes, &aiocb);
         }
     }
 }
 
-nixl_status_t
-aioQueue::submit (const nixl_meta_dlist_t &, const nixl_meta_dlist_t &) {
-    // Submit all I/Os at once
-    for (auto& aiocb : aiocbs) {
-        if (aiocb.aio_fildes == 0 || aiocb.aio_nbytes == 0) continue;
+nixl_status_t aioQueue::fill() {
+    while (num_submitted < num_entries && !free_slots.empty()) {
+        const nixlMetaDesc &local_desc = (*local)[num_submitted];
+        const nixlMetaDesc &remote_desc = (*remote)[num_submitted];
+        struct aiocb &aiocb = aiocbs[free_slots.back()];
 
-        // Check if file descriptor is valid
-        if (aiocb.aio_fildes < 0) {
-            NIXL_ERROR << "Invalid file descriptor in AIO request";
-            return NIXL_ERR_BACKEND;
-        }
+        aiocb.aio_fildes = remote_desc.devId;
+        aiocb.aio_buf = reinterpret_cast<void*>(local_desc.addr);
+        aiocb.aio_nbytes = remote_desc.len;
+        aiocb.aio_offset = remote_desc.addr;
 
         int ret;
         if (operation == NIXL_READ) {
@@ -67,24 +74,34 @@ aioQueue::submit (const nixl_meta_dlist_t &, const nixl_meta_dlist_t &) {
         }
 
         if (ret < 0) {
-            if (errno == EAGAIN) {
-                // If we hit the kernel limit, cancel all submitted I/Os and return error
-                NIXL_ERROR << "AIO submit failed: kernel queue full";
-                for (auto& cb : aiocbs) {
-                    if (cb.aio_fildes != 0) {
-                        aio_cancel(cb.aio_fildes, &cb);
-                    }
-                }
-                return NIXL_ERR_BACKEND;
+            aiocb.aio_nbytes = 0;
+            // Out of resources, retry once some of the in-flight I/Os complete
+            if (errno == EAGAIN && num_submitted > num_completed) {
+                return NIXL_SUCCESS;
             }
             NIXL_PERROR << "AIO submit failed";
             return NIXL_ERR_BACKEND;
         }
 
+        free_slots.pop_back();
         num_submitted++;
     }
 
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+aioQueue::submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) {
+    this->local = &local;
+    this->remote = &remote;
+    num_submitted = 0;
     num_completed = 0;
+
+    // Entries that don't fit in the window are submitted from checkCompleted
+    nixl_status_t status = fill();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
     return NIXL_IN_PROG;
 }
 
@@ -92,9 +109,10 @@ nixl_status_t aioQueue::checkCompleted() {
     if (num_completed == num_entries)
         return NIXL_SUCCESS;
 
-    // Check all submitted I/Os
-    for (auto& aiocb : aiocbs) {
-        if (aiocb.aio_fildes == 0 || aiocb.aio_nbytes == 0)
+    // Only the in-flight window is polled, not the whole transfer
+    for (size_t i = 0; i < aiocbs.size(); i++) {
+        struct aiocb &aiocb = aiocbs[i];
+        if (aiocb.aio_nbytes == 0)
             continue;  // Skip unused control blocks
 
         int status = aio_error(&aiocb);
@@ -105,42 +123,32 @@ nixl_status_t aioQueue::checkCompleted() {
                 return NIXL_ERR_BACKEND;
             }
             num_completed++;
-            aiocb.aio_fildes = 0;  // Mark as completed
-            aiocb.aio_nbytes = 0;
-        } else if (status == EINPROGRESS) {
-            return NIXL_IN_PROG;  // At least one operation still in progress
-        } else {
+            aiocb.aio_nbytes = 0;  // Mark as completed
+            free_slots.push_back(i);
+        } else if (status != EINPROGRESS) {
             NIXL_PERROR << "AIO error";
             return NIXL_ERR_BACKEND;
         }
     }
 
+    nixl_status_t status = fill();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
     return (num_completed == num_entries) ? NIXL_SUCCESS : NIXL_IN_PROG;
 }
 
 nixl_status_t aioQueue::prepIO(int fd, void* buf, size_t len, off_t offset) {
-    // Find an unused control block
-    for (auto& aiocb : aiocbs) {
-        if (aiocb.aio_fildes == 0) {
-            // Check if file descriptor is valid
-            if (fd < 0) {
-                NIXL_ERROR << "Invalid file descriptor provided to prepareIO";
-                return NIXL_ERR_BACKEND;
-            }
-
-            // Check buffer and length
-            if (!buf || len == 0) {
-                NIXL_ERROR << "Invalid buffer or length provided to prepareIO";
-                return NIXL_ERR_BACKEND;
-            }
+    // Control blocks are filled at submission, only validate the I/O here
+    if (fd < 0) {
+        NIXL_ERROR << "Invalid file descriptor provided to prepareIO";
+        return NIXL_ERR_BACKEND;
+    }
 
-            aiocb.aio_fildes = fd;
-            aiocb.aio_buf = buf;
-            aiocb.aio_nbytes = len;
-            aiocb.aio_offset = offset;
-            return NIXL_SUCCESS;
-        }
+    if (!buf || len == 0) {
+        NIXL_ERROR << "Invalid buffer or length provided to prepareIO";
+        return NIXL_ERR_BACKEND;
     }
-    NIXL_ERROR << "No available AIO control blocks";
-    return NIXL_ERR_BACKEND;
+    return NIXL_SUCCESS;
 }
@@ -27,11 +27,17 @@ class nixlPosixBackendReqH;
 
 class aioQueue : public nixlPosixQueue {
     private:
-        std::vector<struct aiocb> aiocbs;  // Array of AIO control blocks
+        std::vector<struct aiocb> aiocbs;  // One AIO control block per in-flight slot
+        std::vector<int> free_slots;       // Slots not used by an in-flight I/O
         int num_entries;                   // Total number of entries expected
         int num_completed;                 // Number of completed operations
         int num_submitted;                 // Track number of submitted I/Os
         nixl_xfer_op_t operation;          // Whether this is a read operation
+        const nixl_meta_dlist_t *local;    // Descriptors of the posted transfer
+        const nixl_meta_dlist_t *remote;
+
+        // Submit remaining entries while there are free slots
+        nixl_status_t fill();
 
         // Delete copy and move operations
         aioQueue(const aioQueue&) = delete;
@@ -40,10 +46,10 @@ class aioQueue : public nixlPosixQueue {
         aioQueue& operator=(aioQueue&&) = delete;
 
     public:
-        aioQueue(int num_entries, nixl_xfer_op_t operation);
+        aioQueue(int num_entries, int max_inflight, nixl_xfer_op_t operation);
         ~aioQueue();
         nixl_status_t
-        submit (const nixl_meta_dlist_t &, const nixl_meta_dlist_t &) override;
+        submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) override;
         nixl_status_t checkCompleted() override;
         nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) override;
 };
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "bounce_pool.h"
+#include <stdlib.h>
+#include <stdexcept>
+
+nixlPosixBouncePool::nixlPosixBouncePool(size_t block_size, size_t num_blocks)
+    : base(nullptr)
+    , block_size(block_size)
+    , num_blocks(num_blocks) {
+    if (block_size == 0 || (block_size & (block_size - 1))) {
+        throw std::invalid_argument("Invalid block size for bounce pool");
+    }
+
+    // An empty pool only carries the alignment, requests allocate their blocks
+    if (num_blocks == 0) {
+        return;
+    }
+
+    void *mem;
+    if (posix_memalign(&mem, block_size, block_size * num_blocks) != 0) {
+        throw std::bad_alloc();
+    }
+    base = static_cast<char*>(mem);
+
+    // Handed out from the back, start from the lowest addresses
+    free_blocks.reserve(num_blocks);
+    for (size_t i = num_blocks; i > 0; i--) {
+        free_blocks.push_back(base + (i - 1) * block_size);
+    }
+}
+
+nixlPosixBouncePool::~nixlPosixBouncePool() {
+    free(base);
+}
+
+bool nixlPosixBouncePool::acquire(size_t count, std::vector<char*> &blocks) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (count > free_blocks.size()) {
+        return false;
+    }
+    blocks.insert(blocks.end(), free_blocks.end() - count, free_blocks.end());
+    free_blocks.resize(free_blocks.size() - count);
+    return true;
+}
+
+void nixlPosixBouncePool::release(const std::vector<char*> &blocks) {
+    std::lock_guard<std::mutex> guard(lock);
+    free_blocks.insert(free_blocks.end(), blocks.begin(), blocks.end());
+}
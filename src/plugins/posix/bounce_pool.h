@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BOUNCE_POOL_H
+#define BOUNCE_POOL_H
+
+#include <mutex>
+#include <sys/uio.h>
+#include <vector>
+
+// Aligned blocks staging the parts of O_DIRECT transfers that don't meet the
+// alignment. The memory is allocated once per engine so it can be registered
+// with io_uring, requests take blocks at preparation and return them when
+// released.
+class nixlPosixBouncePool {
+    private:
+        char *base;
+        const size_t block_size;
+        const size_t num_blocks;
+        std::mutex lock;
+        std::vector<char*> free_blocks;
+
+        nixlPosixBouncePool(const nixlPosixBouncePool&) = delete;
+        nixlPosixBouncePool& operator=(const nixlPosixBouncePool&) = delete;
+
+    public:
+        // block_size is also the alignment of the blocks
+        nixlPosixBouncePool(size_t block_size, size_t num_blocks);
+        ~nixlPosixBouncePool();
+
+        size_t getBlockSize() const { return block_size; }
+        struct iovec getRegion() const { return {base, block_size * num_blocks}; }
+
+        // Takes count blocks, or none and returns false if not enough are free
+        bool acquire(size_t count, std::vector<char*> &blocks);
+        void release(const std::vector<char*> &blocks);
+};
+
+#endif // BOUNCE_POOL_H
@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io_thread_pool.h"
+#include <algorithm>
+#include <stdexcept>
+
+IoThreadPool::IoThreadPool(unsigned num_threads, unsigned max_per_client)
+    : max_per_client(max_per_client ? max_per_client : num_threads)
+    , stop(false) {
+    if (num_threads == 0) {
+        throw std::invalid_argument("Invalid number of threads for IoThreadPool");
+    }
+
+    for (unsigned i = 0; i < num_threads; i++) {
+        threads.emplace_back(&IoThreadPool::worker, this);
+    }
+}
+
+IoThreadPool::~IoThreadPool() {
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+    }
+    ready_cv.notify_all();
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+void IoThreadPool::enqueue(IoThreadPoolClient *client, clientState &state) {
+    if (!state.queued && state.running < state.limit) {
+        ready.push_back(client);
+        state.queued = true;
+        ready_cv.notify_one();
+    }
+}
+
+void IoThreadPool::post(IoThreadPoolClient *client, unsigned limit) {
+    std::lock_guard<std::mutex> guard(lock);
+    clientState &state = clients[client];
+
+    state.limit = std::max(1u, std::min(limit, max_per_client));
+    client->start();
+    enqueue(client, state);
+}
+
+void IoThreadPool::detach(IoThreadPoolClient *client) {
+    std::unique_lock<std::mutex> guard(lock);
+    auto it = clients.find(client);
+    if (it == clients.end()) {
+        return;
+    }
+
+    done_cv.wait(guard, [&] { return it->second.running == 0; });
+    ready.erase(std::remove(ready.begin(), ready.end(), client), ready.end());
+    clients.erase(it);
+}
+
+void IoThreadPool::worker() {
+    std::unique_lock<std::mutex> guard(lock);
+
+    while (true) {
+        ready_cv.wait(guard, [this] { return stop || !ready.empty(); });
+        if (stop) {
+            return;
+        }
+
+        IoThreadPoolClient *client = ready.front();
+        ready.pop_front();
+        clientState &state = clients[client];
+        state.queued = false;
+
+        unsigned idx;
+        if (!client->nextIO(idx)) {
+            continue;  // Nothing left to run, posted again on the next transfer
+        }
+
+        // Back to the tail so the other clients get the next workers
+        state.running++;
+        enqueue(client, state);
+
+        guard.unlock();
+        bool success = client->runIO(idx);
+        guard.lock();
+
+        client->onCompletion(idx, success);
+        clientState &done_state = clients[client];
+        done_state.running--;
+        enqueue(client, done_state);
+        done_cv.notify_all();
+    }
+}
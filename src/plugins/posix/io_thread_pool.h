@@ -0,0 +1,83 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef IO_THREAD_POOL_H
+#define IO_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Source of blocking I/Os run by an IoThreadPool
+class IoThreadPoolClient {
+    public:
+        virtual ~IoThreadPoolClient() = default;
+        // Called with the pool lock held when the client is posted
+        virtual void start() = 0;
+        // Called with the pool lock held, reserves the next I/O to run
+        virtual bool nextIO(unsigned &idx) = 0;
+        // Runs the I/O without the pool lock
+        virtual bool runIO(unsigned idx) = 0;
+        // Called with the pool lock held once the I/O ran
+        virtual void onCompletion(unsigned idx, bool success) = 0;
+};
+
+// Worker threads shared by all the requests of an engine. Clients with pending
+// I/Os wait in a round-robin list and each worker takes a single I/O from the
+// client at its head, so idle workers pick up work from any request and a large
+// request can't starve small ones. A client has at most max_per_client I/Os
+// running at once.
+class IoThreadPool {
+    private:
+        struct clientState {
+            unsigned running = 0;   // I/Os of the client run by workers
+            unsigned limit = 0;     // Maximal number of them
+            bool queued = false;    // In the ready list
+        };
+
+        std::mutex lock;
+        std::condition_variable ready_cv;  // Signals clients added to the ready list
+        std::condition_variable done_cv;   // Signals completions to detach()
+        std::deque<IoThreadPoolClient*> ready;
+        std::unordered_map<IoThreadPoolClient*, clientState> clients;
+        std::vector<std::thread> threads;
+        const unsigned max_per_client;
+        bool stop;
+
+        void enqueue(IoThreadPoolClient *client, clientState &state);
+        void worker();
+
+        IoThreadPool(const IoThreadPool&) = delete;
+        IoThreadPool& operator=(const IoThreadPool&) = delete;
+
+    public:
+        IoThreadPool(unsigned num_threads, unsigned max_per_client);
+        ~IoThreadPool();
+
+        unsigned getNumThreads() const { return threads.size(); }
+        unsigned getMaxPerClient() const { return max_per_client; }
+
+        // Start running the I/Os of client, at most limit at once
+        void post(IoThreadPoolClient *client, unsigned limit);
+        // Stop scheduling client and wait for its running I/Os
+        void detach(IoThreadPoolClient *client);
+};
+
+#endif // IO_THREAD_POOL_H
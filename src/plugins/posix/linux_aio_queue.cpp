@@ -0,0 +1,246 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "linux_aio_queue.h"
+#include "posix_backend.h"
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <algorithm>
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+// glibc has no wrappers for the kernel AIO syscalls and libaio is not required
+namespace {
+    int io_setup(unsigned nr_events, aio_context_t *ctx) {
+        return syscall(SYS_io_setup, nr_events, ctx);
+    }
+
+    int io_destroy(aio_context_t ctx) {
+        return syscall(SYS_io_destroy, ctx);
+    }
+
+    int io_submit(aio_context_t ctx, long nr, struct iocb **iocbpp) {
+        return syscall(SYS_io_submit, ctx, nr, iocbpp);
+    }
+
+    int io_getevents(aio_context_t ctx, long min_nr, long max_nr,
+                     struct io_event *events, struct timespec *timeout) {
+        return syscall(SYS_io_getevents, ctx, min_nr, max_nr, events, timeout);
+    }
+}
+
+linuxAioQueue::linuxAioQueue(int num_entries, int max_inflight, nixl_xfer_op_t operation)
+    : ctx(0)
+    , num_entries(num_entries)
+    , num_completed(0)
+    , num_submitted(0)
+    , operation(operation)
+    , local(nullptr)
+    , remote(nullptr)
+    , extents(nullptr)
+    , iovs(nullptr) {
+    if (num_entries <= 0 || max_inflight <= 0) {
+        throw nixlPosixBackendReqH::exception("Invalid number of entries for Linux AIO queue",
+                                              NIXL_ERR_INVALID_PARAM);
+    }
+
+    int window = std::min(num_entries, max_inflight);
+    if (io_setup(window, &ctx) < 0) {
+        throw nixlPosixBackendReqH::exception(
+            absl::StrFormat("io_setup failed for %d entries: %s", window, strerror(errno)),
+            NIXL_ERR_BACKEND);
+    }
+
+    iocbs.resize(window);
+    batch.reserve(window);
+    events.resize(window);
+    expected.resize(window);
+    for (int i = 0; i < window; i++) {
+        free_slots.push_back(i);
+    }
+}
+
+linuxAioQueue::~linuxAioQueue() {
+    // There should not be any in-flight I/Os at destruction time
+    int in_flight = num_submitted - num_completed;
+    if (in_flight > 0) {
+        NIXL_ERROR << "Programming error: Destroying linuxAioQueue with " << in_flight << " in-flight I/Os";
+
+        // Cancellation is not supported for regular files, wait for them
+        // so the kernel doesn't write to buffers the caller may free
+        while (in_flight > 0) {
+            int ret = io_getevents(ctx, 1, events.size(), events.data(), nullptr);
+            if (ret < 0 && errno != EINTR) {
+                break;
+            }
+            in_flight -= std::max(ret, 0);
+        }
+    }
+
+    io_destroy(ctx);
+}
+
+void linuxAioQueue::prepIocb(struct iocb &cb, int idx) {
+    bool is_read = (operation == NIXL_READ);
+
+    if (extents && (*extents)[idx].count > 1) {
+        const nixlPosixExtent &extent = (*extents)[idx];
+        cb.aio_lio_opcode = is_read ? IOCB_CMD_PREADV : IOCB_CMD_PWRITEV;
+        cb.aio_fildes = extent.fd;
+        cb.aio_buf = reinterpret_cast<uintptr_t>(&(*iovs)[extent.first]);
+        cb.aio_nbytes = extent.count;
+        cb.aio_offset = extent.offset;
+        expected[cb.aio_data] = extent.len;
+        return;
+    }
+
+    int desc = extents ? (*extents)[idx].first : idx;
+    const nixlMetaDesc &local_desc = (*local)[desc];
+    const nixlMetaDesc &remote_desc = (*remote)[desc];
+    cb.aio_lio_opcode = is_read ? IOCB_CMD_PREAD : IOCB_CMD_PWRITE;
+    cb.aio_fildes = remote_desc.devId;
+    cb.aio_buf = local_desc.addr;
+    cb.aio_nbytes = remote_desc.len;
+    cb.aio_offset = remote_desc.addr;
+    expected[cb.aio_data] = remote_desc.len;
+}
+
+nixl_status_t linuxAioQueue::fill() {
+    batch.clear();
+    while (num_submitted + static_cast<int>(batch.size()) < num_entries && !free_slots.empty()) {
+        int idx = num_submitted + batch.size();
+        int slot = free_slots.back();
+        struct iocb &cb = iocbs[slot];
+
+        free_slots.pop_back();
+        memset(&cb, 0, sizeof(cb));
+        cb.aio_data = slot;
+        prepIocb(cb, idx);
+        batch.push_back(&cb);
+    }
+
+    size_t done = 0;
+    bool failed = false;
+    while (done < batch.size()) {
+        int ret = io_submit(ctx, batch.size() - done, batch.data() + done);
+        if (ret < 0 && errno == EINTR) {
+            continue;
+        }
+        if (ret <= 0) {
+            // Out of resources, retry once some of the in-flight I/Os complete
+            if (ret == 0 || (errno == EAGAIN && num_submitted > num_completed)) {
+                break;
+            }
+            NIXL_PERROR << "io_submit failed";
+            failed = true;
+            break;
+        }
+        done += ret;
+        num_submitted += ret;
+    }
+
+    // Control blocks the kernel didn't take go back to the free list
+    for (size_t i = done; i < batch.size(); i++) {
+        free_slots.push_back(batch[i]->aio_data);
+    }
+
+    if (failed || (done < batch.size() && num_submitted == num_completed)) {
+        return NIXL_ERR_BACKEND;
+    }
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+linuxAioQueue::submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) {
+    this->local = &local;
+    this->remote = &remote;
+    num_submitted = 0;
+    num_completed = 0;
+
+    // Entries that don't fit in the window are submitted from checkCompleted
+    nixl_status_t status = fill();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+    return NIXL_IN_PROG;
+}
+
+nixl_status_t linuxAioQueue::checkCompleted() {
+    if (num_completed == num_entries)
+        return NIXL_SUCCESS;
+
+    // Reap all the available completions in one call without blocking
+    struct timespec timeout = {0, 0};
+    int ret = io_getevents(ctx, 0, events.size(), events.data(), &timeout);
+    if (ret < 0) {
+        if (errno == EINTR) {
+            return NIXL_IN_PROG;
+        }
+        NIXL_PERROR << "io_getevents failed";
+        return NIXL_ERR_BACKEND;
+    }
+
+    nixl_status_t status = NIXL_SUCCESS;
+    for (int i = 0; i < ret; i++) {
+        const struct io_event &event = events[i];
+        size_t nbytes = expected[event.data];
+
+        if (event.res < 0 || event.res != static_cast<__s64>(nbytes)) {
+            NIXL_ERROR << absl::StrFormat("Linux AIO operation failed or incomplete: %lld of %zu bytes",
+                                          static_cast<long long>(event.res), nbytes);
+            status = NIXL_ERR_BACKEND;
+        }
+        num_completed++;
+        free_slots.push_back(event.data);
+    }
+
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    status = fill();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    return (num_completed == num_entries) ? NIXL_SUCCESS : NIXL_IN_PROG;
+}
+
+bool linuxAioQueue::setExtents(const std::vector<nixlPosixExtent> *extents,
+                               const std::vector<struct iovec> *iovs) {
+    this->extents = extents;
+    this->iovs = iovs;
+    num_entries = extents->size();
+    return true;
+}
+
+nixl_status_t linuxAioQueue::prepIO(int fd, void* buf, size_t len, off_t offset) {
+    // Control blocks are filled at submission, only validate the I/O here
+    if (fd < 0) {
+        NIXL_ERROR << "Invalid file descriptor provided to prepareIO";
+        return NIXL_ERR_BACKEND;
+    }
+
+    if (!buf || len == 0) {
+        NIXL_ERROR << "Invalid buffer or length provided to prepareIO";
+        return NIXL_ERR_BACKEND;
+    }
+    return NIXL_SUCCESS;
+}
@@ -0,0 +1,66 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LINUX_AIO_QUEUE_H
+#define LINUX_AIO_QUEUE_H
+
+#include <vector>
+#include <linux/aio_abi.h>
+#include "posix_queue.h"
+
+// Kernel AIO queue using io_submit/io_getevents directly, unlike glibc POSIX
+// AIO it does not go through a user-space thread pool. I/Os only complete
+// asynchronously on files opened with O_DIRECT.
+class linuxAioQueue : public nixlPosixQueue {
+    private:
+        aio_context_t ctx;                 // Kernel AIO context sized to the window
+        std::vector<struct iocb> iocbs;    // One control block per in-flight slot
+        std::vector<struct iocb*> batch;   // Control blocks of one io_submit call
+        std::vector<struct io_event> events;
+        std::vector<size_t> expected;      // Bytes each in-flight slot has to transfer
+        std::vector<int> free_slots;       // Slots not used by an in-flight I/O
+        int num_entries;                   // Total number of I/Os expected
+        int num_completed;                 // Number of completed operations
+        int num_submitted;                 // Track number of submitted I/Os
+        nixl_xfer_op_t operation;
+        const nixl_meta_dlist_t *local;    // Descriptors of the posted transfer
+        const nixl_meta_dlist_t *remote;
+        const std::vector<nixlPosixExtent> *extents;  // Coalesced I/Os, null for one per descriptor
+        const std::vector<struct iovec> *iovs;
+
+        void prepIocb(struct iocb &cb, int idx);
+
+        // Submit remaining entries in one batch while there are free slots
+        nixl_status_t fill();
+
+        linuxAioQueue(const linuxAioQueue&) = delete;
+        linuxAioQueue& operator=(const linuxAioQueue&) = delete;
+        linuxAioQueue(linuxAioQueue&&) = delete;
+        linuxAioQueue& operator=(linuxAioQueue&&) = delete;
+
+    public:
+        linuxAioQueue(int num_entries, int max_inflight, nixl_xfer_op_t operation);
+        ~linuxAioQueue();
+        nixl_status_t
+        submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) override;
+        nixl_status_t checkCompleted() override;
+        nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) override;
+        bool setExtents(const std::vector<nixlPosixExtent> *extents,
+                        const std::vector<struct iovec> *iovs) override;
+};
+
+#endif // LINUX_AIO_QUEUE_H
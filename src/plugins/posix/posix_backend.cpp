@@ -15,18 +15,82 @@
  * limitations under the License.
  */
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
 #include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <map>
 #include <stdexcept>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "posix_backend.h"
 #include <absl/log/log.h>
 #include <absl/strings/str_format.h>
 #include "common/nixl_log.h"
 #include "queue_factory_impl.h"
+#include "io_thread_pool.h"
+#include "bounce_pool.h"
 #include "nixl_types.h"
 
+#ifdef HAVE_LIBURING
+#include "uring_ring.h"
+#endif
+
 namespace {
+    // Default queue depth of engine-owned io_uring rings
+    constexpr unsigned default_ring_depth = 256;
+    // Default number of I/Os a request keeps in flight
+    constexpr int default_max_inflight = 256;
+    // Default number of workers of the thread pool queue
+    constexpr unsigned default_thread_pool_size = 8;
+    // Size of the io_uring registered file and buffer tables
+    constexpr unsigned num_fixed_files = 1024;
+    constexpr unsigned num_fixed_buffers = 1024;
+    // A single read/write transfers at most ~2GB, keep coalesced I/Os well below
+    constexpr size_t max_extent_size = 1UL << 30;
+    // opt_args customParam turning a read into a page cache prefetch
+    constexpr char prefetch_param[] = "prefetch";
+    // Registration metaInfo of a FILE_SEG striped over several files
+    constexpr char stripe_prefix[] = "stripe:";
+    // Linux reads at most the readahead window of the device per WILLNEED
+    // advice, 128KB by default, so prefetched ranges are split to that size
+    constexpr size_t prefetch_chunk_size = 128 * 1024;
+    // Alignment of O_DIRECT offsets, lengths and buffers, the largest logical
+    // block size in common use
+    constexpr size_t default_direct_io_align = 4096;
+    // Default size of the bounce pool staging unaligned O_DIRECT I/Os
+    constexpr size_t default_bounce_pool_size = 16UL << 20;
+
+    bool isDirectAligned(const nixlMetaDesc &local_desc, const nixlMetaDesc &remote_desc,
+                         size_t align) {
+        return (local_desc.addr % align) == 0 && (remote_desc.addr % align) == 0 &&
+               (remote_desc.len % align) == 0;
+    }
+
+    // Read a whole block, zero-filling past the end of file
+    bool preadBlock(int fd, char *buf, size_t len, off_t offset) {
+        size_t done = 0;
+        while (done < len) {
+            ssize_t ret = pread(fd, buf + done, len - done, offset + done);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                NIXL_PERROR << absl::StrFormat("pread of bounce block failed on fd %d", fd);
+                return false;
+            }
+            if (ret == 0) {
+                memset(buf + done, 0, len - done);
+                break;
+            }
+            done += ret;
+        }
+        return true;
+    }
+
     bool isValidPrepXferParams(const nixl_xfer_op_t &operation,
                                const nixl_meta_dlist_t &local,
                                const nixl_meta_dlist_t &remote,
@@ -70,6 +134,8 @@ namespace {
         switch (type) {
             case queue_t::AIO: return "AIO";
             case queue_t::URING: return "URING";
+            case queue_t::LINUX_AIO: return "LINUX_AIO";
+            case queue_t::THREADPOOL: return "THREADPOOL";
             case queue_t::UNSUPPORTED: return "UNSUPPORTED";
             default: return "UNKNOWN";
         }
@@ -103,6 +169,20 @@ namespace {
                     return queue_t::URING;
                 }
             }
+
+            if (custom_params->count("use_linux_aio") > 0) {
+                const auto& value = custom_params->at("use_linux_aio");
+                if (value == "true" || value == "1") {
+                    return queue_t::LINUX_AIO;
+                }
+            }
+
+            if (custom_params->count("use_thread_pool") > 0) {
+                const auto& value = custom_params->at("use_thread_pool");
+                if (value == "true" || value == "1") {
+                    return queue_t::THREADPOOL;
+                }
+            }
         }
         return queue_t::AIO;
     }
@@ -116,14 +196,35 @@ nixlPosixBackendReqH::nixlPosixBackendReqH(const nixl_xfer_op_t &op,
                                            const nixl_meta_dlist_t &loc,
                                            const nixl_meta_dlist_t &rem,
                                            const nixl_opt_b_args_t* args,
-                                           const nixl_b_params_t* params)
+                                           const nixl_b_params_t* params,
+                                           int max_inflight,
+                                           bool coalesce,
+                                           std::shared_ptr<UringRing> ring,
+                                           std::shared_ptr<IoThreadPool> pool,
+                                           std::shared_ptr<nixlPosixBouncePool> bounce_pool,
+                                           const nixlPosixMetadata *bounce_md)
     : operation(op)
     , local(loc)
     , remote(rem)
     , opt_args(args)
     , custom_params_(params)
     , queue_depth_(loc.descCount())
-    , queue_type_(getQueueType(params)) {
+    , max_inflight_(max_inflight)
+    , queue_type_(getQueueType(params))
+    , ring_(std::move(ring))
+    , pool_(std::move(pool))
+    , coalesce_(coalesce)
+    , prefetch_(args && args->customParam == prefetch_param)
+    , advise_sync_(false)
+    , bounce_pool_(std::move(bounce_pool))
+    , bounce_md_(bounce_md)
+    , bounce_private_(nullptr)
+    , striped_(false)
+    , stripe_local_(DRAM_SEG)
+    , stripe_remote_(FILE_SEG)
+    , use_io_lists_(false)
+    , io_local_(DRAM_SEG)
+    , io_remote_(FILE_SEG) {
     if (queue_type_ == nixlPosixQueue::queue_t::UNSUPPORTED) {
         throw exception(
             absl::StrFormat("Unsupported backend type: %s", queue_type_),
@@ -136,12 +237,440 @@ nixlPosixBackendReqH::nixlPosixBackendReqH(const nixl_xfer_op_t &op,
             NIXL_ERR_INVALID_PARAM);
     }
 
+    if (prefetch_ && operation != NIXL_READ) {
+        throw exception("Prefetch is only supported for reads", NIXL_ERR_INVALID_PARAM);
+    }
+
+    planStripes();
+    if (prefetch_) {
+        planPrefetch();
+    } else if (bounce_pool_) {
+        planBounce();
+    }
+    queue_depth_ = ioLocal().descCount();
+
+    // Transfers read entirely with pread at post have nothing to queue
+    if (queue_depth_ == 0) {
+        return;
+    }
+
     nixl_status_t status = initQueues();
     if (status != NIXL_SUCCESS) {
+        releaseBounce();
         throw exception(
             absl::StrFormat("Failed to initialize queues: %s", queue_type_),
             status);
     }
+
+    // AIO has no asynchronous fadvise, the hints are cheap enough to give at post
+    if (prefetch_ && !queue->setPrefetch()) {
+        queue.reset();
+        advise_sync_ = true;
+    }
+}
+
+nixlPosixBackendReqH::~nixlPosixBackendReqH() {
+    // The queue waits for its in-flight I/Os, which may target the bounce blocks
+    queue.reset();
+    releaseBounce();
+}
+
+void nixlPosixBackendReqH::releaseBounce() {
+    if (bounce_private_) {
+        free(bounce_private_);
+        bounce_private_ = nullptr;
+    } else if (!bounce_bufs_.empty()) {
+        bounce_pool_->release(bounce_bufs_);
+    }
+    bounce_bufs_.clear();
+}
+
+// Split the descriptors of striped files at stripe boundaries and map each piece
+// to its member file, RAID-0 style. With coalescing the pieces are ordered by
+// file so the stripes of a member in one descriptor become one vectored I/O.
+void nixlPosixBackendReqH::planStripes() {
+    auto is_striped = [](const nixlMetaDesc &desc) {
+        auto md = static_cast<const nixlPosixMetadata*>(desc.metadataP);
+        return md && !md->stripes.empty();
+    };
+    if (std::none_of(remote.begin(), remote.end(), is_striped)) {
+        return;
+    }
+
+    std::vector<std::pair<nixlMetaDesc, nixlMetaDesc>> pieces;
+    for (int i = 0; i < remote.descCount(); i++) {
+        const nixlMetaDesc &local_desc = local[i];
+        const nixlMetaDesc &remote_desc = remote[i];
+        if (!is_striped(remote_desc)) {
+            pieces.emplace_back(local_desc, remote_desc);
+            continue;
+        }
+
+        auto md = static_cast<const nixlPosixMetadata*>(remote_desc.metadataP);
+        const size_t unit = md->stripeUnit;
+        const size_t width = md->stripes.size();
+        for (size_t done = 0; done < remote_desc.len;) {
+            const size_t offset = remote_desc.addr + done;
+            const size_t stripe = offset / unit;
+            const size_t len = std::min(remote_desc.len - done, unit - offset % unit);
+            const nixlPosixMetadata &member = *md->stripes[stripe % width];
+
+            nixlMetaDesc piece_local(local_desc.addr + done, len, local_desc.devId);
+            nixlMetaDesc piece_remote((stripe / width) * unit + offset % unit, len,
+                                      member.fd);
+            piece_local.metadataP = local_desc.metadataP;
+            piece_remote.metadataP = const_cast<nixlPosixMetadata*>(&member);
+            pieces.emplace_back(piece_local, piece_remote);
+            done += len;
+        }
+    }
+
+    if (coalesce_) {
+        std::stable_sort(pieces.begin(), pieces.end(), [](const auto &a, const auto &b) {
+            return std::make_pair(a.second.devId, a.second.addr) <
+                   std::make_pair(b.second.devId, b.second.addr);
+        });
+    }
+
+    striped_ = true;
+    for (auto &[piece_local, piece_remote] : pieces) {
+        stripe_local_.addDesc(piece_local);
+        stripe_remote_.addDesc(piece_remote);
+    }
+    NIXL_DEBUG << absl::StrFormat("Striped %d descriptors into %zu pieces",
+                                  remote.descCount(), pieces.size());
+}
+
+// Merge the file ranges to prefetch, in any order of the descriptors, and split
+// them in chunks the kernel reads in full. The page cache is bypassed by O_DIRECT
+// so those files are skipped.
+void nixlPosixBackendReqH::planPrefetch() {
+    const nixl_meta_dlist_t &local = srcLocal();
+    const nixl_meta_dlist_t &remote = srcRemote();
+    std::vector<std::pair<nixlMetaDesc, nixlMetaDesc>> ranges;
+
+    for (int i = 0; i < remote.descCount(); i++) {
+        auto rmd = static_cast<const nixlPosixMetadata*>(remote[i].metadataP);
+        if (rmd && rmd->direct) {
+            continue;
+        }
+        ranges.emplace_back(local[i], remote[i]);
+    }
+
+    std::sort(ranges.begin(), ranges.end(), [](const auto &a, const auto &b) {
+        return std::make_pair(a.second.devId, a.second.addr) <
+               std::make_pair(b.second.devId, b.second.addr);
+    });
+
+    std::vector<std::pair<nixlMetaDesc, nixlMetaDesc>> merged;
+    for (auto &range : ranges) {
+        if (!merged.empty()) {
+            nixlMetaDesc &last = merged.back().second;
+            if (last.devId == range.second.devId && range.second.addr <= last.addr + last.len) {
+                last.len = std::max(last.len, range.second.addr + range.second.len - last.addr);
+                continue;
+            }
+        }
+        merged.push_back(range);
+    }
+
+    use_io_lists_ = true;
+    for (auto &[range_local, range_remote] : merged) {
+        for (uintptr_t offset = range_remote.addr; offset < range_remote.addr + range_remote.len;) {
+            uintptr_t next = std::min(range_remote.addr + range_remote.len,
+                                      (offset / prefetch_chunk_size + 1) * prefetch_chunk_size);
+            io_local_.addDesc(nixlMetaDesc(range_local.addr, next - offset, range_local.devId));
+            io_remote_.addDesc(nixlMetaDesc(offset, next - offset, range_remote.devId));
+            io_remote_[io_remote_.descCount() - 1].metadataP = range_remote.metadataP;
+            offset = next;
+        }
+    }
+
+    NIXL_DEBUG << absl::StrFormat("Prefetching %d descriptors as %zu ranges in %d chunks",
+                                  remote.descCount(), merged.size(), io_remote_.descCount());
+}
+
+nixl_status_t nixlPosixBackendReqH::adviseWillNeed() {
+    for (const auto &range : io_remote_) {
+        int ret = posix_fadvise(range.devId, range.addr, range.len, POSIX_FADV_WILLNEED);
+        if (ret != 0) {
+            NIXL_ERROR << absl::StrFormat("posix_fadvise failed on fd %d: %s",
+                                          static_cast<int>(range.devId), strerror(ret));
+            return NIXL_ERR_BACKEND;
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+// Split the descriptors of O_DIRECT files that don't meet the alignment. The
+// aligned middle of a descriptor goes straight to the user buffer when it has
+// the same misalignment as the file offset, the head and tail, or the whole
+// descriptor otherwise, go through bounce blocks. Descriptors touching the same
+// file block share its bounce block, so a write never overwrites the data
+// another descriptor patched in.
+void nixlPosixBackendReqH::planBounce() {
+    const nixl_meta_dlist_t &local = srcLocal();
+    const nixl_meta_dlist_t &remote = srcRemote();
+    const size_t align = bounce_pool_->getBlockSize();
+    const unsigned num_descs = remote.descCount();
+    std::vector<std::pair<nixlMetaDesc, nixlMetaDesc>> ios;
+    std::map<std::pair<int, off_t>, std::pair<unsigned, const nixlMetaDesc*>> blocks;
+    std::vector<std::pair<std::pair<int, off_t>, bounceCopy>> copies;
+    std::map<int, off_t> write_ends;
+
+    auto add_bounce = [&](const nixlMetaDesc &remote_desc, char *user, off_t start, off_t end) {
+        const int fd = remote_desc.devId;
+        for (off_t block = start - start % align; block < end; block += align) {
+            off_t from = std::max(start, block);
+            off_t to = std::min(end, static_cast<off_t>(block + align));
+            blocks.emplace(std::make_pair(fd, block), std::make_pair(0u, &remote_desc));
+            copies.push_back({{fd, block},
+                              {user + (from - start), 0, static_cast<size_t>(from - block),
+                               static_cast<size_t>(to - from)}});
+        }
+    };
+
+    for (unsigned i = 0; i < num_descs; i++) {
+        const nixlMetaDesc &local_desc = local[i];
+        const nixlMetaDesc &remote_desc = remote[i];
+        auto rmd = static_cast<const nixlPosixMetadata*>(remote_desc.metadataP);
+
+        if (operation == NIXL_WRITE) {
+            off_t &write_end = write_ends[remote_desc.devId];
+            write_end = std::max(write_end, static_cast<off_t>(remote_desc.addr + remote_desc.len));
+        }
+
+        if (!rmd || !rmd->direct || isDirectAligned(local_desc, remote_desc, align)) {
+            ios.emplace_back(local_desc, remote_desc);
+            continue;
+        }
+
+        char *user = reinterpret_cast<char*>(local_desc.addr);
+        const off_t start = remote_desc.addr;
+        const off_t end = start + remote_desc.len;
+        off_t mid_start = end;
+        off_t mid_end = end;
+
+        if ((local_desc.addr - remote_desc.addr) % align == 0) {
+            off_t up = (start + align - 1) / align * align;
+            off_t down = end / align * align;
+            if (up < down) {
+                mid_start = up;
+                mid_end = down;
+            }
+        }
+
+        if (mid_start < mid_end) {
+            nixlMetaDesc mid_local = local_desc;
+            nixlMetaDesc mid_remote = remote_desc;
+            mid_local.addr += mid_start - start;
+            mid_local.len = mid_end - mid_start;
+            mid_remote.addr = mid_start;
+            mid_remote.len = mid_end - mid_start;
+            ios.emplace_back(mid_local, mid_remote);
+        }
+
+        if (start < mid_start) {
+            add_bounce(remote_desc, user, start, mid_start);
+        }
+        if (mid_end < end) {
+            add_bounce(remote_desc, user + (mid_end - start), mid_end, end);
+        }
+    }
+
+    if (blocks.empty()) {
+        return;
+    }
+    use_io_lists_ = true;
+
+    // Blocks are numbered in file order so neighbours coalesce into one I/O
+    std::map<int, off_t> file_sizes;
+    for (auto &[key, block] : blocks) {
+        block.first = bounce_blocks_.size();
+        bounceBlock bb = {key.first, key.second, 0, false};
+
+        // A write of the block at the end of file is padded, so keep where the
+        // written data ends. The file size is only checked at post, it may change
+        // before each post of the request.
+        if (operation == NIXL_WRITE) {
+            bounce_ends_[key.first] = write_ends[key.first];
+        } else {
+            bb.sync = crossesEof(bb, file_sizes);
+        }
+        bounce_blocks_.push_back(bb);
+    }
+
+    for (auto &[key, copy] : copies) {
+        copy.block = blocks[key].first;
+        bounce_blocks_[copy.block].covered += copy.len;
+        bounce_copies_.push_back(copy);
+    }
+
+    const size_t num_blocks = bounce_blocks_.size();
+    if (!bounce_pool_->acquire(num_blocks, bounce_bufs_)) {
+        void *mem;
+        if (posix_memalign(&mem, align, num_blocks * align) != 0) {
+            throw exception(absl::StrFormat("Failed to allocate %zu bounce blocks", num_blocks),
+                            NIXL_ERR_BACKEND);
+        }
+        NIXL_DEBUG << absl::StrFormat("Bounce pool exhausted, allocated %zu blocks", num_blocks);
+        bounce_private_ = static_cast<char*>(mem);
+        for (size_t i = 0; i < num_blocks; i++) {
+            bounce_bufs_.push_back(bounce_private_ + i * align);
+        }
+    }
+
+    for (auto &[key, block] : blocks) {
+        const bounceBlock &bb = bounce_blocks_[block.first];
+        if (bb.sync) {
+            continue;
+        }
+        nixlMetaDesc block_local(reinterpret_cast<uintptr_t>(bounce_bufs_[block.first]), align, 0);
+        nixlMetaDesc block_remote(bb.offset, align, bb.fd);
+        block_local.metadataP = bounce_private_ ? nullptr :
+                                const_cast<nixlPosixMetadata*>(bounce_md_);
+        block_remote.metadataP = block.second->metadataP;
+        ios.emplace_back(block_local, block_remote);
+    }
+
+    std::stable_sort(ios.begin(), ios.end(), [](const auto &a, const auto &b) {
+        return std::make_pair(a.second.devId, a.second.addr) <
+               std::make_pair(b.second.devId, b.second.addr);
+    });
+    for (auto &[io_local, io_remote] : ios) {
+        io_local_.addDesc(io_local);
+        io_remote_.addDesc(io_remote);
+    }
+
+    NIXL_DEBUG << absl::StrFormat("Staging %zu O_DIRECT blocks of %u descriptors in bounce buffers",
+                                  num_blocks, num_descs);
+}
+
+// O_DIRECT reads stop short at the end of file. The aio and thread pool queues
+// fail on a short read and io_uring doesn't check the length, so the block that
+// crosses it is read with pread at post, which zero-fills past the end.
+bool nixlPosixBackendReqH::crossesEof(const bounceBlock &bb,
+                                      std::map<int, off_t> &file_sizes) const {
+    auto it = file_sizes.find(bb.fd);
+    if (it == file_sizes.end()) {
+        struct stat st;
+        off_t size = (fstat(bb.fd, &st) == 0) ? st.st_size : -1;
+        it = file_sizes.emplace(bb.fd, size).first;
+    }
+    return it->second >= 0 && bb.offset < it->second &&
+           static_cast<off_t>(bb.offset + bounce_pool_->getBlockSize()) > it->second;
+}
+
+// The blocks of a read that cross the end of file were picked at prep. When the
+// file changed size since, plan the staging and prepare the I/Os again.
+nixl_status_t nixlPosixBackendReqH::refreshBounce() {
+    std::map<int, off_t> file_sizes;
+    bool stale = false;
+    for (const auto &bb : bounce_blocks_) {
+        if (crossesEof(bb, file_sizes) != bb.sync) {
+            stale = true;
+            break;
+        }
+    }
+    if (!stale) {
+        return NIXL_SUCCESS;
+    }
+
+    NIXL_DEBUG << "File size changed since prep, planning the O_DIRECT staging again";
+    queue.reset();
+    releaseBounce();
+    bounce_blocks_.clear();
+    bounce_copies_.clear();
+    io_local_.clear();
+    io_remote_.clear();
+    use_io_lists_ = false;
+    extents_.clear();
+    iovs_.clear();
+
+    nixl_status_t status = NIXL_SUCCESS;
+    try {
+        planBounce();
+    } catch (const nixlPosixBackendReqH::exception& e) {
+        NIXL_ERROR << absl::StrFormat("Failed to plan the O_DIRECT staging: %s", e.what());
+        status = e.code();
+    }
+    queue_depth_ = ioLocal().descCount();
+    if (status == NIXL_SUCCESS && queue_depth_ > 0) {
+        status = initQueues();
+        if (status == NIXL_SUCCESS) {
+            status = prepXfer();
+        }
+    }
+
+    // Half planned, the request fails the next posts too and can only be released
+    if (status != NIXL_SUCCESS) {
+        queue.reset();
+        releaseBounce();
+        bounce_blocks_.clear();
+        bounce_copies_.clear();
+        queue_depth_ = -1;
+    }
+    return status;
+}
+
+// Before the I/Os: read the blocks at the end of file for a read, and for a
+// write read the blocks it only partly covers then patch in the user data
+nixl_status_t nixlPosixBackendReqH::stageBounce() {
+    const size_t align = bounce_pool_->getBlockSize();
+    const bool is_read = (operation == NIXL_READ);
+
+    // Blocks crossing the end of file grow it up to the block boundary,
+    // it's cut back to the end of the written data once the I/Os complete
+    bounce_truncs_.clear();
+    for (const auto &[fd, write_end] : bounce_ends_) {
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            NIXL_PERROR << absl::StrFormat("fstat failed on fd %d", fd);
+            return NIXL_ERR_BACKEND;
+        }
+        for (const auto &bb : bounce_blocks_) {
+            if (bb.fd == fd && static_cast<off_t>(bb.offset + align) > st.st_size) {
+                bounce_truncs_[fd] = std::max(static_cast<off_t>(st.st_size), write_end);
+                break;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < bounce_blocks_.size(); i++) {
+        const bounceBlock &bb = bounce_blocks_[i];
+        if ((is_read && bb.sync) || (!is_read && bb.covered < align)) {
+            if (!preadBlock(bb.fd, bounce_bufs_[i], align, bb.offset)) {
+                return NIXL_ERR_BACKEND;
+            }
+        }
+    }
+
+    if (!is_read) {
+        for (const auto &copy : bounce_copies_) {
+            memcpy(bounce_bufs_[copy.block] + copy.offset, copy.user, copy.len);
+        }
+    }
+    return NIXL_SUCCESS;
+}
+
+// After the I/Os: for a read copy the staged data to the user buffers, for a
+// write drop the padding of the blocks written past the end of file
+nixl_status_t nixlPosixBackendReqH::unstageBounce() {
+    if (operation == NIXL_READ) {
+        for (const auto &copy : bounce_copies_) {
+            memcpy(copy.user, bounce_bufs_[copy.block] + copy.offset, copy.len);
+        }
+        return NIXL_SUCCESS;
+    }
+
+    for (const auto &[fd, size] : bounce_truncs_) {
+        if (ftruncate(fd, size) != 0) {
+            NIXL_PERROR << absl::StrFormat("ftruncate to %lld failed on fd %d",
+                                           static_cast<long long>(size), fd);
+            return NIXL_ERR_BACKEND;
+        }
+    }
+    return NIXL_SUCCESS;
 }
 
 
@@ -149,10 +678,16 @@ nixl_status_t nixlPosixBackendReqH::initQueues() {
     try {
         switch (queue_type_) {
             case nixlPosixQueue::queue_t::AIO:
-                queue = QueueFactory::createAioQueue(queue_depth_, operation);
+                queue = QueueFactory::createAioQueue(queue_depth_, max_inflight_, operation);
                 break;
             case nixlPosixQueue::queue_t::URING:
-                queue = QueueFactory::createUringQueue(queue_depth_, operation);
+                queue = QueueFactory::createUringQueue(queue_depth_, max_inflight_, operation, ring_);
+                break;
+            case nixlPosixQueue::queue_t::LINUX_AIO:
+                queue = QueueFactory::createLinuxAioQueue(queue_depth_, max_inflight_, operation);
+                break;
+            case nixlPosixQueue::queue_t::THREADPOOL:
+                queue = QueueFactory::createThreadPoolQueue(queue_depth_, max_inflight_, operation, pool_);
                 break;
             default:
                 NIXL_ERROR << absl::StrFormat("Invalid queue type: %s", queue_type_);
@@ -169,6 +704,12 @@ nixl_status_t nixlPosixBackendReqH::initQueues() {
 }
 
 nixl_status_t nixlPosixBackendReqH::prepXfer() {
+    if (!queue) {
+        return NIXL_SUCCESS;
+    }
+
+    const nixl_meta_dlist_t &local = ioLocal();
+    const nixl_meta_dlist_t &remote = ioRemote();
     for (auto [local_it, remote_it] = std::make_pair(local.begin(), remote.begin());
          local_it != local.end() && remote_it != remote.end();
          ++local_it, ++remote_it) {
@@ -185,15 +726,77 @@ nixl_status_t nixlPosixBackendReqH::prepXfer() {
         }
     }
 
+    if (coalesce_ && !prefetch_) {
+        coalesceExtents();
+    }
+
     return NIXL_SUCCESS;
 }
 
+void nixlPosixBackendReqH::coalesceExtents() {
+    const nixl_meta_dlist_t &local = ioLocal();
+    const nixl_meta_dlist_t &remote = ioRemote();
+    std::vector<nixlPosixExtent> extents;
+    const unsigned num_descs = remote.descCount();
+
+    iovs_.resize(num_descs);
+    for (unsigned i = 0; i < num_descs; i++) {
+        const nixlMetaDesc &remote_desc = remote[i];
+        const int fd = remote_desc.devId;
+        iovs_[i] = {reinterpret_cast<void*>(local[i].addr), remote_desc.len};
+
+        if (!extents.empty()) {
+            nixlPosixExtent &last = extents.back();
+            if (last.fd == fd &&
+                last.offset + static_cast<off_t>(last.len) == static_cast<off_t>(remote_desc.addr) &&
+                last.count < IOV_MAX && last.len + remote_desc.len <= max_extent_size) {
+                last.len += remote_desc.len;
+                last.count++;
+                continue;
+            }
+        }
+        extents.push_back({fd, static_cast<off_t>(remote_desc.addr),
+                           remote_desc.len, i, 1});
+    }
+
+    // Nothing adjacent, or glibc AIO which has no vectored operations
+    extents_ = std::move(extents);
+    if (extents_.size() == num_descs || !queue->setExtents(&extents_, &iovs_)) {
+        extents_.clear();
+        iovs_.clear();
+        return;
+    }
+
+    NIXL_DEBUG << absl::StrFormat("Coalesced %u descriptors into %zu I/Os", num_descs, extents_.size());
+}
+
 nixl_status_t nixlPosixBackendReqH::checkXfer() {
-    return queue->checkCompleted();
+    nixl_status_t status = queue ? queue->checkCompleted() : NIXL_SUCCESS;
+    if (status == NIXL_SUCCESS && !bounce_blocks_.empty()) {
+        status = unstageBounce();
+    }
+    return status;
 }
 
 nixl_status_t nixlPosixBackendReqH::postXfer() {
-    return queue->submit (local, remote);
+    if (!bounce_blocks_.empty()) {
+        nixl_status_t status = (operation == NIXL_READ) ? refreshBounce() : NIXL_SUCCESS;
+        if (status == NIXL_SUCCESS) {
+            status = stageBounce();
+        }
+        if (status != NIXL_SUCCESS) {
+            return status;
+        }
+    }
+
+    if (advise_sync_) {
+        return adviseWillNeed();
+    }
+
+    if (!queue) {
+        return (queue_depth_ < 0) ? NIXL_ERR_BACKEND : unstageBounce();
+    }
+    return queue->submit (ioLocal(), ioRemote());
 }
 
 // -----------------------------------------------------------------------------
@@ -202,27 +805,477 @@ nixl_status_t nixlPosixBackendReqH::postXfer() {
 
 nixlPosixEngine::nixlPosixEngine(const nixlBackendInitParams* init_params)
     : nixlBackendEngine(init_params)
-    , queue_type_(getQueueType(init_params->customParams)) {
+    , queue_type_(getQueueType(init_params->customParams))
+    , max_inflight_(default_max_inflight)
+    , coalesce_(true)
+    , num_prepped_descs_(0)
+    , num_prepped_ios_(0)
+    , ring_mode_(ring_mode_t::SHARED)
+    , ring_depth_(default_ring_depth)
+    , direct_io_align_(default_direct_io_align)
+    , bounce_pool_size_(default_bounce_pool_size)
+    , uring_fixed_(false) {
     if (queue_type_ == nixlPosixQueue::queue_t::UNSUPPORTED) {
         initErr = true;
         NIXL_ERROR << absl::StrFormat("Failed to initialize POSIX backend - requested backend not available: %s",
                                       queue_type_);
         return;
     }
+
+    const nixl_b_params_t* custom_params = init_params->customParams;
+    if (custom_params && custom_params->count("max_inflight") > 0) {
+        try {
+            max_inflight_ = std::stoi(custom_params->at("max_inflight"));
+        } catch (const std::exception& e) {
+            max_inflight_ = 0;
+        }
+        if (max_inflight_ <= 0) {
+            initErr = true;
+            NIXL_ERROR << absl::StrFormat("Invalid max_inflight: %s", custom_params->at("max_inflight"));
+            return;
+        }
+    }
+
+    if (custom_params && custom_params->count("coalesce_io") > 0) {
+        const auto& value = custom_params->at("coalesce_io");
+        coalesce_ = (value == "true" || value == "1");
+    }
+
+    if (initDirectIO(custom_params) != NIXL_SUCCESS) {
+        initErr = true;
+        return;
+    }
+
+    if (queue_type_ == nixlPosixQueue::queue_t::URING &&
+        initUringRings(init_params->customParams) != NIXL_SUCCESS) {
+        initErr = true;
+        return;
+    }
+
+    if (queue_type_ == nixlPosixQueue::queue_t::THREADPOOL &&
+        initThreadPool(init_params->customParams) != NIXL_SUCCESS) {
+        initErr = true;
+        return;
+    }
     NIXL_INFO << absl::StrFormat("POSIX backend initialized using %s backend", queue_type_);
 }
 
+nixlPosixEngine::~nixlPosixEngine() {
+    uint64_t descs = num_prepped_descs_;
+    uint64_t ios = num_prepped_ios_;
+    if (descs > ios) {
+        NIXL_INFO << absl::StrFormat("POSIX backend coalesced %lu descriptors into %lu I/Os, "
+                                     "saving %lu I/Os per post", descs, ios, descs - ios);
+    }
+}
+
+nixl_status_t nixlPosixEngine::initDirectIO(const nixl_b_params_t* custom_params) {
+    try {
+        if (custom_params && custom_params->count("direct_io_align") > 0) {
+            direct_io_align_ = std::stoul(custom_params->at("direct_io_align"));
+        }
+        if (custom_params && custom_params->count("bounce_pool_size") > 0) {
+            bounce_pool_size_ = std::stoul(custom_params->at("bounce_pool_size"));
+        }
+    } catch (const std::exception& e) {
+        NIXL_ERROR << absl::StrFormat("Invalid direct I/O param: %s", e.what());
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (direct_io_align_ & (direct_io_align_ - 1)) {
+        NIXL_ERROR << absl::StrFormat("Invalid direct_io_align: %zu, must be a power of 2",
+                                      direct_io_align_);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+    return NIXL_SUCCESS;
+}
+
+void nixlPosixEngine::initBouncePool() {
+    std::lock_guard<std::mutex> guard(bounce_lock_);
+
+    if (bounce_pool_ || direct_io_align_ == 0) {
+        return;
+    }
+
+    // Requests allocate their own blocks when the pool is exhausted or empty
+    const size_t num_blocks = bounce_pool_size_ / direct_io_align_;
+    try {
+        bounce_pool_ = std::make_shared<nixlPosixBouncePool>(direct_io_align_, num_blocks);
+    } catch (const std::exception& e) {
+        NIXL_WARN << absl::StrFormat("Failed to allocate the bounce pool: %s", e.what());
+        return;
+    }
+
+    int fixed_idx = -1;
+    if (uring_fixed_ && num_blocks > 0) {
+        fixed_idx = registerFixedBuffer(bounce_pool_->getRegion());
+    }
+    bounce_md_ = std::make_unique<nixlPosixMetadata>(DRAM_SEG, fixed_idx);
+    NIXL_INFO << absl::StrFormat("POSIX bounce pool: %zu blocks of %zu bytes for unaligned O_DIRECT I/O",
+                                 num_blocks, direct_io_align_);
+}
+
+nixl_status_t nixlPosixEngine::initThreadPool(const nixl_b_params_t* custom_params) {
+    unsigned num_threads = default_thread_pool_size;
+    unsigned max_per_request = 0;
+
+    try {
+        if (custom_params && custom_params->count("thread_pool_size") > 0) {
+            num_threads = std::stoul(custom_params->at("thread_pool_size"));
+        }
+        if (custom_params && custom_params->count("thread_pool_max_per_request") > 0) {
+            max_per_request = std::stoul(custom_params->at("thread_pool_max_per_request"));
+        }
+    } catch (const std::exception& e) {
+        NIXL_ERROR << absl::StrFormat("Invalid thread pool param: %s", e.what());
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (num_threads == 0) {
+        NIXL_ERROR << "Invalid thread_pool_size: 0";
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    io_pool_ = std::make_shared<IoThreadPool>(num_threads, max_per_request);
+    NIXL_INFO << absl::StrFormat("POSIX thread pool: %u threads, at most %u per request",
+                                 io_pool_->getNumThreads(), io_pool_->getMaxPerClient());
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlPosixEngine::initUringRings(const nixl_b_params_t* custom_params) {
+    std::string mode = "shared";
+    bool use_fixed = true;
+
+    if (custom_params) {
+        if (custom_params->count("uring_ring") > 0) {
+            mode = custom_params->at("uring_ring");
+        }
+
+        if (custom_params->count("uring_fixed") > 0) {
+            const auto& value = custom_params->at("uring_fixed");
+            use_fixed = (value == "true" || value == "1");
+        }
+
+        if (custom_params->count("uring_sqpoll") > 0) {
+            const auto& value = custom_params->at("uring_sqpoll");
+            ring_opts_.sqpoll = (value == "true" || value == "1");
+        }
+
+        if (custom_params->count("uring_iopoll") > 0) {
+            const auto& value = custom_params->at("uring_iopoll");
+            ring_opts_.iopoll = (value == "true" || value == "1");
+        }
+
+        try {
+            if (custom_params->count("uring_sq_thread_cpu") > 0) {
+                ring_opts_.sq_thread_cpu = std::stoi(custom_params->at("uring_sq_thread_cpu"));
+            }
+            if (custom_params->count("uring_sq_thread_idle") > 0) {
+                ring_opts_.sq_thread_idle = std::stoul(custom_params->at("uring_sq_thread_idle"));
+            }
+        } catch (const std::exception& e) {
+            NIXL_ERROR << absl::StrFormat("Invalid io_uring SQ thread param: %s", e.what());
+            return NIXL_ERR_INVALID_PARAM;
+        }
+
+        if (custom_params->count("uring_queue_depth") > 0) {
+            try {
+                ring_depth_ = std::stoul(custom_params->at("uring_queue_depth"));
+            } catch (const std::exception& e) {
+                ring_depth_ = 0;
+            }
+            if (ring_depth_ == 0) {
+                NIXL_ERROR << absl::StrFormat("Invalid uring_queue_depth: %s",
+                                              custom_params->at("uring_queue_depth"));
+                return NIXL_ERR_INVALID_PARAM;
+            }
+        }
+    }
+
+    if (mode == "shared") {
+        ring_mode_ = ring_mode_t::SHARED;
+    } else if (mode == "per_thread") {
+        ring_mode_ = ring_mode_t::PER_THREAD;
+    } else if (mode == "per_request") {
+        ring_mode_ = ring_mode_t::PER_REQUEST;
+    } else {
+        NIXL_ERROR << absl::StrFormat("Invalid uring_ring: %s, must be one of "
+                                      "[shared, per_thread, per_request]", mode);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    // A polling thread or polled completions per request would cost more than they save
+    if (ring_mode_ == ring_mode_t::PER_REQUEST && (ring_opts_.sqpoll || ring_opts_.iopoll)) {
+        NIXL_WARN << "io_uring SQPOLL and IOPOLL are ignored with per_request rings";
+        ring_opts_ = uringRingOpts();
+    }
+
+    // Private rings are too short-lived to be worth registering anything with
+    if (use_fixed && ring_mode_ != ring_mode_t::PER_REQUEST) {
+        uring_fixed_ = true;
+        fixed_files_.assign(num_fixed_files, -1);
+        fixed_file_refs_.assign(num_fixed_files, 0);
+        fixed_buffers_.assign(num_fixed_buffers, iovec{nullptr, 0});
+    }
+
+    if (ring_mode_ == ring_mode_t::SHARED) {
+        try {
+            shared_ring_ = QueueFactory::createUringRing(ring_depth_, ring_opts_);
+        } catch (const nixlPosixBackendReqH::exception& e) {
+            NIXL_ERROR << absl::StrFormat("Failed to create io_uring ring: %s", e.what());
+            return e.code();
+        } catch (const std::exception& e) {
+            NIXL_ERROR << absl::StrFormat("Failed to create io_uring ring: %s", e.what());
+            return NIXL_ERR_BACKEND;
+        }
+        initFixed(*shared_ring_);
+    }
+
+    NIXL_INFO << absl::StrFormat("POSIX io_uring ring mode: %s, depth: %u, registered files and buffers: %s",
+                                 mode, ring_depth_, uring_fixed_ ? "on" : "off");
+    return NIXL_SUCCESS;
+}
+
+std::vector<UringRing*> nixlPosixEngine::getAllRings() const {
+    std::vector<UringRing*> rings;
+
+    if (shared_ring_) {
+        rings.push_back(shared_ring_.get());
+    }
+    for (auto &[id, ring] : thread_rings_) {
+        rings.push_back(ring.get());
+    }
+    return rings;
+}
+
+#ifdef HAVE_LIBURING
+void nixlPosixEngine::initFixed(UringRing &ring) const {
+    if (!uring_fixed_ || !ring.initFixed(num_fixed_files, num_fixed_buffers)) {
+        return;
+    }
+
+    // A ring created after some memory was registered needs the current slots,
+    // requests use the same slots on every ring so it's all or nothing
+    for (size_t i = 0; i < fixed_files_.size(); i++) {
+        if (fixed_files_[i] >= 0 && !ring.setFixedFile(i, fixed_files_[i])) {
+            ring.disableFixed();
+            return;
+        }
+    }
+    for (size_t i = 0; i < fixed_buffers_.size(); i++) {
+        if (fixed_buffers_[i].iov_base && !ring.setFixedBuffer(i, fixed_buffers_[i])) {
+            ring.disableFixed();
+            return;
+        }
+    }
+}
+
+int nixlPosixEngine::registerFixedFile(int fd) {
+    std::lock_guard<std::mutex> guard(rings_lock_);
+
+    auto it = fixed_file_slots_.find(fd);
+    if (it != fixed_file_slots_.end()) {
+        fixed_file_refs_[it->second]++;
+        return it->second;
+    }
+
+    auto free_it = std::find(fixed_files_.begin(), fixed_files_.end(), -1);
+    if (free_it == fixed_files_.end()) {
+        return -1;
+    }
+
+    int idx = free_it - fixed_files_.begin();
+    for (auto ring : getAllRings()) {
+        if (ring->hasFixed() && !ring->setFixedFile(idx, fd)) {
+            for (auto r : getAllRings()) {
+                if (r->hasFixed()) {
+                    r->setFixedFile(idx, -1);
+                }
+            }
+            return -1;
+        }
+    }
+
+    fixed_files_[idx] = fd;
+    fixed_file_refs_[idx] = 1;
+    fixed_file_slots_[fd] = idx;
+    return idx;
+}
+
+int nixlPosixEngine::registerFixedBuffer(const struct iovec &iov) {
+    std::lock_guard<std::mutex> guard(rings_lock_);
+
+    auto free_it = std::find_if(fixed_buffers_.begin(), fixed_buffers_.end(),
+                                [](const struct iovec &v) { return v.iov_base == nullptr; });
+    if (free_it == fixed_buffers_.end()) {
+        return -1;
+    }
+
+    int idx = free_it - fixed_buffers_.begin();
+    for (auto ring : getAllRings()) {
+        if (ring->hasFixed() && !ring->setFixedBuffer(idx, iov)) {
+            for (auto r : getAllRings()) {
+                if (r->hasFixed()) {
+                    r->setFixedBuffer(idx, iovec{nullptr, 0});
+                }
+            }
+            return -1;
+        }
+    }
+
+    fixed_buffers_[idx] = iov;
+    return idx;
+}
+
+void nixlPosixEngine::deregisterFixed(const nixlPosixMetadata &md) {
+    std::lock_guard<std::mutex> guard(rings_lock_);
+
+    if (md.type == FILE_SEG) {
+        if (--fixed_file_refs_[md.fixedIdx] > 0) {
+            return;
+        }
+        fixed_file_slots_.erase(fixed_files_[md.fixedIdx]);
+        fixed_files_[md.fixedIdx] = -1;
+        for (auto ring : getAllRings()) {
+            if (ring->hasFixed()) {
+                ring->setFixedFile(md.fixedIdx, -1);
+            }
+        }
+    } else {
+        fixed_buffers_[md.fixedIdx] = iovec{nullptr, 0};
+        for (auto ring : getAllRings()) {
+            if (ring->hasFixed()) {
+                ring->setFixedBuffer(md.fixedIdx, iovec{nullptr, 0});
+            }
+        }
+    }
+}
+
+#else
+void nixlPosixEngine::initFixed(UringRing &ring) const {
+}
+
+int nixlPosixEngine::registerFixedFile(int fd) {
+    return -1;
+}
+
+int nixlPosixEngine::registerFixedBuffer(const struct iovec &iov) {
+    return -1;
+}
+
+void nixlPosixEngine::deregisterFixed(const nixlPosixMetadata &md) {
+}
+#endif
+
+std::shared_ptr<UringRing> nixlPosixEngine::getUringRing() const {
+    switch (ring_mode_) {
+        case ring_mode_t::SHARED:
+            return shared_ring_;
+        case ring_mode_t::PER_THREAD: {
+            std::lock_guard<std::mutex> guard(rings_lock_);
+            auto &ring = thread_rings_[std::this_thread::get_id()];
+            if (!ring) {
+                ring = QueueFactory::createUringRing(ring_depth_, ring_opts_);
+                initFixed(*ring);
+            }
+            return ring;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+nixlPosixMetadata *nixlPosixEngine::createFileMetadata(int fd) {
+    // Register with io_uring up front so the kernel doesn't look up the fd on
+    // every I/O, falls back to plain I/O if it can't
+    int fixed_idx = uring_fixed_ ? registerFixedFile(fd) : -1;
+
+    // Unaligned descriptors of O_DIRECT files are staged in bounce blocks
+    bool direct = false;
+    if (direct_io_align_ > 0) {
+        int flags = fcntl(fd, F_GETFL);
+        direct = (flags >= 0) && (flags & O_DIRECT);
+        if (direct) {
+            initBouncePool();
+        }
+    }
+
+    auto md = new nixlPosixMetadata(FILE_SEG, fixed_idx, direct);
+    md->fd = fd;
+    return md;
+}
+
+void nixlPosixEngine::releaseFileMetadata(nixlPosixMetadata *md) {
+    for (auto &member : md->stripes) {
+        releaseFileMetadata(member.get());
+    }
+    if (md->fixedIdx >= 0) {
+        deregisterFixed(*md);
+    }
+}
+
 nixl_status_t nixlPosixEngine::registerMem(const nixlBlobDesc &mem,
                                            const nixl_mem_t &nixl_mem,
                                            nixlBackendMD* &out) {
     auto supported_mems = getSupportedMems();
-    if (std::find(supported_mems.begin(), supported_mems.end(), nixl_mem) != supported_mems.end())
+    if (std::find(supported_mems.begin(), supported_mems.end(), nixl_mem) == supported_mems.end())
+        return NIXL_ERR_NOT_SUPPORTED;
+
+    if (nixl_mem == DRAM_SEG) {
+        // Registered buffers save the kernel pinning the pages on every I/O
+        int fixed_idx = -1;
+        if (uring_fixed_) {
+            fixed_idx = registerFixedBuffer(iovec{reinterpret_cast<void*>(mem.addr), mem.len});
+        }
+        out = new nixlPosixMetadata(nixl_mem, fixed_idx);
         return NIXL_SUCCESS;
+    }
 
-    return NIXL_ERR_NOT_SUPPORTED;
+    if (mem.metaInfo.compare(0, strlen(stripe_prefix), stripe_prefix) != 0) {
+        out = createFileMetadata(mem.devId);
+        return NIXL_SUCCESS;
+    }
+
+    // "stripe:<unit>:<fd>,<fd>,...", devId only identifies the striped file
+    size_t unit = 0;
+    std::vector<int> fds;
+    try {
+        std::string spec = mem.metaInfo.substr(strlen(stripe_prefix));
+        size_t colon = spec.find(':');
+        if (colon == std::string::npos) {
+            throw std::invalid_argument("missing file list");
+        }
+        unit = std::stoul(spec.substr(0, colon));
+        std::string list = spec.substr(colon + 1);
+        for (size_t pos = 0; pos <= list.size();) {
+            size_t comma = std::min(list.find(',', pos), list.size());
+            fds.push_back(std::stoi(list.substr(pos, comma - pos)));
+            pos = comma + 1;
+        }
+    } catch (const std::exception& e) {
+        NIXL_ERROR << absl::StrFormat("Invalid stripe spec '%s': %s", mem.metaInfo, e.what());
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    if (unit == 0 || std::any_of(fds.begin(), fds.end(), [](int fd) { return fd < 0; })) {
+        NIXL_ERROR << absl::StrFormat("Invalid stripe spec '%s'", mem.metaInfo);
+        return NIXL_ERR_INVALID_PARAM;
+    }
+
+    auto md = new nixlPosixMetadata(FILE_SEG, -1);
+    md->stripeUnit = unit;
+    for (int fd : fds) {
+        md->stripes.emplace_back(createFileMetadata(fd));
+    }
+    out = md;
+    return NIXL_SUCCESS;
 }
 
-nixl_status_t nixlPosixEngine::deregisterMem(nixlBackendMD *) {
+nixl_status_t nixlPosixEngine::deregisterMem(nixlBackendMD *meta) {
+    auto md = static_cast<nixlPosixMetadata*>(meta);
+
+    releaseFileMetadata(md);
+    delete md;
     return NIXL_SUCCESS;
 }
 
@@ -246,17 +1299,43 @@ nixl_status_t nixlPosixEngine::prepXfer(const nixl_xfer_op_t &operation,
             case nixlPosixQueue::queue_t::URING:
                 params["use_uring"] = "true";
                 break;
+            case nixlPosixQueue::queue_t::LINUX_AIO:
+                params["use_linux_aio"] = "true";
+                break;
+            case nixlPosixQueue::queue_t::THREADPOOL:
+                params["use_thread_pool"] = "true";
+                break;
             default:
                 NIXL_ERROR << absl::StrFormat("Invalid queue type: %s", queue_type_);
                 return NIXL_ERR_INVALID_PARAM;
         }
 
-        auto posix_handle = std::make_unique<nixlPosixBackendReqH>(operation, local, remote, opt_args, &params);
+        std::shared_ptr<UringRing> ring;
+        if (queue_type_ == nixlPosixQueue::queue_t::URING) {
+            ring = getUringRing();
+        }
+
+        std::shared_ptr<nixlPosixBouncePool> bounce_pool;
+        const nixlPosixMetadata *bounce_md = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(bounce_lock_);
+            bounce_pool = bounce_pool_;
+            bounce_md = bounce_md_.get();
+        }
+
+        auto posix_handle = std::make_unique<nixlPosixBackendReqH>(operation, local, remote, opt_args,
+                                                                   &params, max_inflight_,
+                                                                   coalesce_, std::move(ring),
+                                                                   io_pool_, std::move(bounce_pool),
+                                                                   bounce_md);
         nixl_status_t status = posix_handle->prepXfer();
         if (status != NIXL_SUCCESS) {
             return status;
         }
 
+        num_prepped_descs_ += local.descCount();
+        num_prepped_ios_ += posix_handle->getNumIOs();
+
         handle = posix_handle.release();
         return NIXL_SUCCESS;
     } catch (const nixlPosixBackendReqH::exception& e) {
@@ -277,7 +1356,7 @@ nixl_status_t nixlPosixEngine::postXfer(const nixl_xfer_op_t &operation,
     try {
         auto& posix_handle = castPosixHandle(handle);
         nixl_status_t status = posix_handle.postXfer();
-        if (status != NIXL_IN_PROG) {
+        if (status != NIXL_IN_PROG && status != NIXL_SUCCESS) {
             NIXL_ERROR << "Error in submitting queue";
         }
         return status;
@@ -18,12 +18,39 @@
 #ifndef POSIX_BACKEND_H
 #define POSIX_BACKEND_H
 
+#include <atomic>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <sys/uio.h>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <absl/strings/str_format.h>
 #include "backend/backend_engine.h"
 #include "posix_queue.h"
+#include "queue_factory_impl.h"
+
+class UringRing;
+class IoThreadPool;
+class nixlPosixBouncePool;
+
+class nixlPosixMetadata : public nixlBackendMD {
+public:
+    const nixl_mem_t type;
+    const int        fixedIdx;  // Slot in the io_uring registered file or buffer table, -1 if none
+    const bool       direct;    // File opened with O_DIRECT
+
+    // Files a striped registration spreads its address space over, round robin
+    // in stripeUnit chunks. Empty for a regular file.
+    std::vector<std::unique_ptr<nixlPosixMetadata>> stripes;
+    size_t           stripeUnit = 0;
+    int              fd = -1;   // File of a stripe member
+
+    nixlPosixMetadata(nixl_mem_t type, int fixed_idx, bool direct = false)
+        : nixlBackendMD(true), type(type), fixedIdx(fixed_idx), direct(direct) {}
+};
 
 class nixlPosixBackendReqH : public nixlBackendReqH {
 private:
@@ -32,24 +59,97 @@ private:
     const nixl_meta_dlist_t         &remote;         // Remote memory descriptor list
     const nixl_opt_b_args_t         *opt_args;       // Optional backend-specific arguments
     const nixl_b_params_t           *custom_params_; // Custom backend parameters
-    const int                       queue_depth_;    // Queue depth for async I/O
+    int                             queue_depth_;    // Queue depth for async I/O
+    const int                       max_inflight_;   // Maximal number of I/Os in flight at once
     std::unique_ptr<nixlPosixQueue> queue;           // Async I/O queue instance
     const nixlPosixQueue::queue_t   queue_type_;     // Type of queue used
+    std::shared_ptr<UringRing>      ring_;           // Engine-owned ring, null for a private one
+    std::shared_ptr<IoThreadPool>   pool_;           // Engine-wide pool of the thread pool queue
+    const bool                      coalesce_;       // Merge file-contiguous descriptors
+    const bool                      prefetch_;       // Only warm up the page cache for a later read
+    bool                            advise_sync_;    // Prefetch with posix_fadvise at post
+    std::vector<nixlPosixExtent>    extents_;        // Coalesced I/Os, empty for one per descriptor
+    std::vector<struct iovec>       iovs_;           // One iovec per descriptor for the extents
+
+    // Aligned file block staged in a bounce buffer for O_DIRECT
+    struct bounceBlock {
+        int      fd;
+        off_t    offset;
+        size_t   covered;    // Bytes of the block the transfer touches
+        bool     sync;       // Read with pread at post as it crosses the end of file
+    };
+    // Part of a descriptor copied between the user buffer and a bounce block
+    struct bounceCopy {
+        char     *user;
+        unsigned block;
+        size_t   offset;     // Offset in the block
+        size_t   len;
+    };
+
+    std::shared_ptr<nixlPosixBouncePool> bounce_pool_;
+    const nixlPosixMetadata         *bounce_md_;     // Registration of the pool memory
+    std::vector<bounceBlock>        bounce_blocks_;  // Empty if all the descriptors are aligned
+    std::vector<char*>              bounce_bufs_;    // One buffer per block
+    std::vector<bounceCopy>         bounce_copies_;
+    char                            *bounce_private_; // Blocks allocated when the pool is exhausted
+    std::map<int, off_t>            bounce_ends_;    // End of a write per file it stages blocks of
+    std::map<int, off_t>            bounce_truncs_;  // Size to restore on files grown by padded blocks
+    bool                            striped_;        // Some descriptors are on striped files
+    nixl_meta_dlist_t               stripe_local_;   // Descriptors split per stripe member file
+    nixl_meta_dlist_t               stripe_remote_;
+    bool                            use_io_lists_;
+    nixl_meta_dlist_t               io_local_;       // I/Os submitted instead of the descriptors, when
+    nixl_meta_dlist_t               io_remote_;      // staged in bounce blocks or merged for a prefetch
 
     nixl_status_t initQueues();                      // Initialize async I/O queue
+    void coalesceExtents();
+    void planStripes();
+    void planPrefetch();
+    nixl_status_t adviseWillNeed();
+    void planBounce();
+    bool crossesEof(const bounceBlock &bb, std::map<int, off_t> &file_sizes) const;
+    nixl_status_t refreshBounce();
+    void releaseBounce();
+    nixl_status_t stageBounce();
+    nixl_status_t unstageBounce();
+
+    // Descriptors after striping, before staging or prefetch merging
+    const nixl_meta_dlist_t &srcLocal() const {
+        return striped_ ? stripe_local_ : local;
+    }
+    const nixl_meta_dlist_t &srcRemote() const {
+        return striped_ ? stripe_remote_ : remote;
+    }
+    const nixl_meta_dlist_t &ioLocal() const {
+        return use_io_lists_ ? io_local_ : srcLocal();
+    }
+    const nixl_meta_dlist_t &ioRemote() const {
+        return use_io_lists_ ? io_remote_ : srcRemote();
+    }
 
 public:
     nixlPosixBackendReqH(const nixl_xfer_op_t &operation,
                          const nixl_meta_dlist_t &local,
                          const nixl_meta_dlist_t &remote,
                          const nixl_opt_b_args_t* opt_args,
-                         const nixl_b_params_t* custom_params);
-    ~nixlPosixBackendReqH() {};
+                         const nixl_b_params_t* custom_params,
+                         int max_inflight,
+                         bool coalesce,
+                         std::shared_ptr<UringRing> ring = nullptr,
+                         std::shared_ptr<IoThreadPool> pool = nullptr,
+                         std::shared_ptr<nixlPosixBouncePool> bounce_pool = nullptr,
+                         const nixlPosixMetadata *bounce_md = nullptr);
+    ~nixlPosixBackendReqH();
 
     nixl_status_t postXfer();
     nixl_status_t prepXfer();
     nixl_status_t checkXfer();
 
+    // Number of I/Os a post issues, lower than the descriptor count if coalesced
+    size_t getNumIOs() const {
+        return extents_.empty() ? ioLocal().descCount() : extents_.size();
+    }
+
     // Exception classes
     class exception: public std::exception {
         private:
@@ -63,11 +163,57 @@ public:
 
 class nixlPosixEngine : public nixlBackendEngine {
 private:
+    // Which io_uring ring the requests submit to
+    enum class ring_mode_t {
+        SHARED,       // One ring for the whole engine
+        PER_THREAD,   // One ring per thread preparing requests
+        PER_REQUEST,  // A private ring per request, sized to its descriptor count
+    };
+
     const nixlPosixQueue::queue_t queue_type_;
+    int max_inflight_;
+    bool coalesce_;
+    // Descriptors prepared and I/Os they were coalesced into, for the stats
+    mutable std::atomic<uint64_t> num_prepped_descs_;
+    mutable std::atomic<uint64_t> num_prepped_ios_;
+    ring_mode_t ring_mode_;
+    unsigned ring_depth_;
+    uringRingOpts ring_opts_;  // Polling modes, only used for engine-owned rings
+    std::shared_ptr<IoThreadPool> io_pool_;
+    // Staging of the unaligned parts of O_DIRECT transfers, created when the
+    // first O_DIRECT file is registered
+    size_t direct_io_align_;
+    size_t bounce_pool_size_;
+    mutable std::mutex bounce_lock_;
+    std::shared_ptr<nixlPosixBouncePool> bounce_pool_;
+    std::unique_ptr<nixlPosixMetadata> bounce_md_;
+    std::shared_ptr<UringRing> shared_ring_;
+    mutable std::mutex rings_lock_;
+    mutable std::unordered_map<std::thread::id, std::shared_ptr<UringRing>> thread_rings_;
+
+    // Registered files and buffers, mirrored in every engine-owned ring
+    bool uring_fixed_;
+    std::vector<int> fixed_files_;                      // Slot to fd, -1 if free
+    std::vector<unsigned> fixed_file_refs_;             // Registrations using each file slot
+    std::unordered_map<int, unsigned> fixed_file_slots_;
+    std::vector<struct iovec> fixed_buffers_;           // Slot to buffer, null if free
+
+    nixl_status_t initUringRings(const nixl_b_params_t* custom_params);
+    nixl_status_t initThreadPool(const nixl_b_params_t* custom_params);
+    nixl_status_t initDirectIO(const nixl_b_params_t* custom_params);
+    nixlPosixMetadata *createFileMetadata(int fd);
+    void releaseFileMetadata(nixlPosixMetadata *md);
+    void initBouncePool();
+    std::shared_ptr<UringRing> getUringRing() const;
+    void initFixed(UringRing &ring) const;
+    std::vector<UringRing*> getAllRings() const;
+    int registerFixedFile(int fd);
+    int registerFixedBuffer(const struct iovec &iov);
+    void deregisterFixed(const nixlPosixMetadata &md);
 
 public:
     nixlPosixEngine(const nixlBackendInitParams* init_params);
-    virtual ~nixlPosixEngine() = default;
+    virtual ~nixlPosixEngine();
 
     bool supportsRemote() const override {
         return false;
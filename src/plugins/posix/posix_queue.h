@@ -21,6 +21,18 @@
 #include "nixl_types.h"
 #include "backend/backend_aux.h"
 #include <sys/types.h>
+#include <sys/uio.h>
+#include <vector>
+
+// Run of descriptors contiguous in the same file, submitted as one vectored I/O
+// with one iovec per descriptor starting at iovs[first]
+struct nixlPosixExtent {
+    int fd;
+    off_t offset;
+    size_t len;       // Total bytes of the run
+    unsigned first;   // Index of the first descriptor
+    unsigned count;   // Number of descriptors
+};
 
 // Abstract base class for async I/O operations
 class nixlPosixQueue {
@@ -31,9 +43,24 @@ class nixlPosixQueue {
         virtual nixl_status_t checkCompleted() = 0;
         virtual nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) = 0;
 
+        // Submit one I/O per extent instead of one per descriptor, the vectors
+        // must outlive the queue. Returns false if vectored I/O isn't supported.
+        virtual bool setExtents(const std::vector<nixlPosixExtent> *extents,
+                                const std::vector<struct iovec> *iovs) {
+            return false;
+        }
+
+        // Advise the kernel to read the remote ranges into the page cache
+        // instead of transferring data. Returns false if not supported.
+        virtual bool setPrefetch() {
+            return false;
+        }
+
     enum class queue_t {
         AIO,
         URING,
+        LINUX_AIO,
+        THREADPOOL,
         UNSUPPORTED,
     };
 };
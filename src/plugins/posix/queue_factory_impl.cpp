@@ -1,83 +1,159 @@
-/*
- * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
- * SPDX-License-Identifier: Apache-2.0
- *
- * Licensed under the Apache License, Version 2.0 (the "License");
- * you may not use this file except in compliance with the License.
- * You may obtain a copy of the License at
- *
- * http://www.apache.org/licenses/LICENSE-2.0
- *
- * Unless required by applicable law or agreed to in writing, software
- * distributed under the License is distributed on an "AS IS" BASIS,
- * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
- * See the License for the specific language governing permissions and
- * limitations under the License.
- */
-
-#include <memory>
-#include "queue_factory_impl.h"
-#include "posix_queue.h"
-#include "posix_backend.h"
-#include "aio_queue.h"
-
-#ifdef HAVE_LIBURING
-#include "uring_queue.h"
-#endif
-
-// Anonymous namespace for internal template implementations for functions that use the optional liburing
-namespace {
-    struct uringEnabled {};
-    struct uringDisabled {};
-
-#ifdef HAVE_LIBURING
-    using uringMode = uringEnabled;
-#else
-    using uringMode = uringDisabled;
-#endif
-
-    template <typename Mode, typename Enable = void>
-    struct funcImpl;
-
-    template <typename Mode>
-    struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringEnabled>::value>> {
-        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation) {
-            // Initialize io_uring parameters with basic configuration
-            // Start with basic parameters, no special flags
-            // We can add optimizations like SQPOLL later
-            struct io_uring_params params = {};
-            return std::make_unique<class UringQueue>(num_entries, params, operation);
-        }
-
-        static bool isUringAvailable() {
-            return true;
-        }
-    };
-
-    template <typename Mode>
-    struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringDisabled>::value>> {
-        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation) {
-            (void)num_entries;
-            (void)operation;
-            throw nixlPosixBackendReqH::exception("Attempting to create io_uring queue when support is not compiled in",
-                                                  NIXL_ERR_NOT_SUPPORTED);
-        }
-
-        static bool isUringAvailable() {
-            return false;
-        }
-    };
-}
-
-// Public functions implementation
-std::unique_ptr<nixlPosixQueue> QueueFactory::createAioQueue(int num_entries, nixl_xfer_op_t operation) {
-    return std::make_unique<aioQueue>(num_entries, operation);
-}
-
-std::unique_ptr<nixlPosixQueue> QueueFactory::createUringQueue(int num_entries, nixl_xfer_op_t operation) {
-    return funcImpl<uringMode>::createUringQueue(num_entries, operation);
-}
-
-bool QueueFactory::isUringAvailable() {
-    return funcImpl<uringMode>::isUringAvailable();
-}
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include "queue_factory_impl.h"
+#include "posix_queue.h"
+#include "posix_backend.h"
+#include "aio_queue.h"
+#include "linux_aio_queue.h"
+#include "thread_pool_queue.h"
+#include "common/nixl_log.h"
+
+#ifdef HAVE_LIBURING
+#include "uring_queue.h"
+#endif
+
+// Anonymous namespace for internal template implementations for functions that use the optional liburing
+namespace {
+    struct uringEnabled {};
+    struct uringDisabled {};
+
+#ifdef HAVE_LIBURING
+    using uringMode = uringEnabled;
+#else
+    using uringMode = uringDisabled;
+#endif
+
+    template <typename Mode, typename Enable = void>
+    struct funcImpl;
+
+#ifdef HAVE_LIBURING
+    // Uses the liburing flags, only compiled with io_uring support
+    template <typename Mode>
+    struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringEnabled>::value>> {
+        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, int max_inflight,
+                                                                nixl_xfer_op_t operation,
+                                                                std::shared_ptr<UringRing> ring) {
+            if (!ring) {
+                ring = createUringRing(std::min(num_entries, max_inflight), uringRingOpts());
+            }
+            return std::make_unique<class UringQueue>(num_entries, max_inflight, std::move(ring),
+                                                      operation);
+        }
+
+        static std::shared_ptr<UringRing> createUringRing(unsigned depth, const uringRingOpts &opts) {
+            struct io_uring_params params = {};
+
+            if (opts.sqpoll) {
+                params.flags |= IORING_SETUP_SQPOLL;
+                params.sq_thread_idle = opts.sq_thread_idle;
+                if (opts.sq_thread_cpu >= 0) {
+                    params.flags |= IORING_SETUP_SQ_AFF;
+                    params.sq_thread_cpu = opts.sq_thread_cpu;
+                }
+            }
+            if (opts.iopoll) {
+                params.flags |= IORING_SETUP_IOPOLL;
+            }
+
+            if (params.flags == 0) {
+                return std::make_shared<UringRing>(depth, params);
+            }
+
+            try {
+                auto ring = std::make_shared<UringRing>(depth, params);
+                // Before Linux 5.11 an SQPOLL ring only accepts registered files
+                if (!opts.sqpoll || (ring->getFeatures() & IORING_FEAT_SQPOLL_NONFIXED)) {
+                    NIXL_INFO << absl::StrFormat("io_uring ring created with%s%s",
+                                                 opts.sqpoll ? " SQPOLL" : "",
+                                                 opts.iopoll ? " IOPOLL" : "");
+                    return ring;
+                }
+                NIXL_WARN << "io_uring SQPOLL needs registered files on this kernel";
+            } catch (const std::runtime_error &e) {
+                NIXL_WARN << absl::StrFormat("io_uring polling modes not available: %s", e.what());
+            }
+
+            NIXL_WARN << "Falling back to io_uring ring without SQPOLL and IOPOLL";
+            return std::make_shared<UringRing>(depth, io_uring_params{});
+        }
+
+        static bool isUringAvailable() {
+            return true;
+        }
+    };
+#endif
+
+    template <typename Mode>
+    struct funcImpl<Mode, std::enable_if_t<std::is_same<Mode, uringDisabled>::value>> {
+        static std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, int max_inflight,
+                                                                nixl_xfer_op_t operation,
+                                                                std::shared_ptr<UringRing> ring) {
+            (void)num_entries;
+            (void)max_inflight;
+            (void)operation;
+            (void)ring;
+            throw nixlPosixBackendReqH::exception("Attempting to create io_uring queue when support is not compiled in",
+                                                  NIXL_ERR_NOT_SUPPORTED);
+        }
+
+        static std::shared_ptr<UringRing> createUringRing(unsigned depth, const uringRingOpts &opts) {
+            (void)depth;
+            (void)opts;
+            throw nixlPosixBackendReqH::exception("Attempting to create io_uring ring when support is not compiled in",
+                                                  NIXL_ERR_NOT_SUPPORTED);
+        }
+
+        static bool isUringAvailable() {
+            return false;
+        }
+    };
+}
+
+// Public functions implementation
+std::unique_ptr<nixlPosixQueue> QueueFactory::createAioQueue(int num_entries, int max_inflight,
+                                                             nixl_xfer_op_t operation) {
+    return std::make_unique<aioQueue>(num_entries, max_inflight, operation);
+}
+
+std::unique_ptr<nixlPosixQueue> QueueFactory::createLinuxAioQueue(int num_entries, int max_inflight,
+                                                                  nixl_xfer_op_t operation) {
+    return std::make_unique<linuxAioQueue>(num_entries, max_inflight, operation);
+}
+
+std::unique_ptr<nixlPosixQueue> QueueFactory::createThreadPoolQueue(int num_entries, int max_inflight,
+                                                                    nixl_xfer_op_t operation,
+                                                                    std::shared_ptr<IoThreadPool> pool) {
+    return std::make_unique<ThreadPoolQueue>(num_entries, max_inflight, std::move(pool), operation);
+}
+
+std::unique_ptr<nixlPosixQueue> QueueFactory::createUringQueue(int num_entries, int max_inflight,
+                                                               nixl_xfer_op_t operation,
+                                                               std::shared_ptr<UringRing> ring) {
+    return funcImpl<uringMode>::createUringQueue(num_entries, max_inflight, operation,
+                                                 std::move(ring));
+}
+
+std::shared_ptr<UringRing> QueueFactory::createUringRing(unsigned depth, const uringRingOpts &opts) {
+    return funcImpl<uringMode>::createUringRing(depth, opts);
+}
+
+bool QueueFactory::isUringAvailable() {
+    return funcImpl<uringMode>::isUringAvailable();
+}
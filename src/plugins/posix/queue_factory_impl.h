@@ -18,12 +18,44 @@
 #ifndef QUEUE_FACTORY_IMPL_H
 #define QUEUE_FACTORY_IMPL_H
 
+#include <memory>
 #include "posix_queue.h"
 
+class UringRing;
+class IoThreadPool;
+
+// Setup options of engine-owned io_uring rings
+struct uringRingOpts {
+    bool sqpoll = false;          // Kernel thread polls the SQ, no syscall per submit
+    bool iopoll = false;          // Busy-poll completions, only for O_DIRECT files
+    int sq_thread_cpu = -1;       // CPU to pin the SQ thread to, -1 for any
+    unsigned sq_thread_idle = 0;  // ms before an idle SQ thread sleeps, 0 for kernel default
+};
+
 namespace QueueFactory {
-    std::unique_ptr<nixlPosixQueue> createAioQueue(int num_entries, nixl_xfer_op_t operation);
+    // Queues keep at most max_inflight of their num_entries I/Os in flight
+    // and submit the rest as earlier ones complete
+    std::unique_ptr<nixlPosixQueue> createAioQueue(int num_entries, int max_inflight,
+                                                   nixl_xfer_op_t operation);
+
+    // Kernel AIO queue (io_submit), bypasses the glibc AIO thread pool
+    std::unique_ptr<nixlPosixQueue> createLinuxAioQueue(int num_entries, int max_inflight,
+                                                        nixl_xfer_op_t operation);
+
+    // Queue running blocking I/Os on the given engine-wide pool
+    std::unique_ptr<nixlPosixQueue> createThreadPoolQueue(int num_entries, int max_inflight,
+                                                          nixl_xfer_op_t operation,
+                                                          std::shared_ptr<IoThreadPool> pool);
+
+    // Queue submitting to the given ring, or to a private ring sized to
+    // the window if ring is null
+    std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, int max_inflight,
+                                                     nixl_xfer_op_t operation,
+                                                     std::shared_ptr<UringRing> ring = nullptr);
 
-    std::unique_ptr<nixlPosixQueue> createUringQueue(int num_entries, nixl_xfer_op_t operation);
+    // Long-lived ring to be shared by many queues. If the kernel rejects the
+    // polling options the ring is created without them.
+    std::shared_ptr<UringRing> createUringRing(unsigned depth, const uringRingOpts &opts = {});
 
     bool isUringAvailable();
 };
@@ -0,0 +1,181 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "thread_pool_queue.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <stdexcept>
+#include <absl/strings/str_format.h>
+#include "common/nixl_log.h"
+
+namespace {
+    // Loop over short transfers until all of iov is done
+    bool rwFull(bool is_read, int fd, const struct iovec *iov, int iovcnt, off_t offset) {
+        std::vector<struct iovec> rest;
+
+        while (iovcnt > 0) {
+            ssize_t ret = is_read ? preadv(fd, iov, iovcnt, offset) :
+                                    pwritev(fd, iov, iovcnt, offset);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                NIXL_PERROR << absl::StrFormat("%s failed on fd %d", is_read ? "pread" : "pwrite", fd);
+                return false;
+            }
+            if (ret == 0) {
+                NIXL_ERROR << absl::StrFormat("Unexpected end of file on fd %d at offset %ld",
+                                              fd, static_cast<long>(offset));
+                return false;
+            }
+
+            offset += ret;
+            while (iovcnt > 0 && static_cast<size_t>(ret) >= iov->iov_len) {
+                ret -= iov->iov_len;
+                iov++;
+                iovcnt--;
+            }
+            if (ret > 0) {
+                // Partially done iovec, continue from a trimmed copy
+                rest.assign(iov, iov + iovcnt);
+                rest[0].iov_base = static_cast<char*>(rest[0].iov_base) + ret;
+                rest[0].iov_len -= ret;
+                iov = rest.data();
+            }
+        }
+        return true;
+    }
+}
+
+ThreadPoolQueue::ThreadPoolQueue(int num_entries, int max_inflight,
+                                 std::shared_ptr<IoThreadPool> pool, nixl_xfer_op_t operation)
+    : pool(std::move(pool))
+    , num_entries(num_entries)
+    , max_inflight(max_inflight)
+    , is_read(operation == NIXL_READ)
+    , prefetch(false)
+    , next_io(0)
+    , num_completed(0)
+    , failed(false)
+    , local(nullptr)
+    , remote(nullptr)
+    , extents(nullptr)
+    , iovs(nullptr) {
+    if (num_entries <= 0 || max_inflight <= 0) {
+        throw std::invalid_argument("Invalid number of entries for ThreadPoolQueue");
+    }
+    if (!this->pool) {
+        throw std::invalid_argument("Invalid thread pool for ThreadPoolQueue");
+    }
+}
+
+ThreadPoolQueue::~ThreadPoolQueue() {
+    // Workers refer to this queue and its buffers until their I/Os return
+    pool->detach(this);
+}
+
+nixl_status_t
+ThreadPoolQueue::submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) {
+    this->local = &local;
+    this->remote = &remote;
+    pool->post(this, max_inflight);
+    return NIXL_IN_PROG;
+}
+
+void ThreadPoolQueue::start() {
+    next_io = 0;
+    num_completed = 0;
+    failed = false;
+}
+
+bool ThreadPoolQueue::nextIO(unsigned &idx) {
+    // Stop handing out I/Os once the transfer failed
+    if (failed || next_io == static_cast<unsigned>(num_entries)) {
+        return false;
+    }
+    idx = next_io++;
+    return true;
+}
+
+bool ThreadPoolQueue::runIO(unsigned idx) {
+    if (prefetch) {
+        const nixlMetaDesc &remote_desc = (*remote)[idx];
+        int ret = posix_fadvise(remote_desc.devId, remote_desc.addr, remote_desc.len,
+                                POSIX_FADV_WILLNEED);
+        if (ret != 0) {
+            NIXL_ERROR << absl::StrFormat("posix_fadvise failed on fd %d: %s",
+                                          static_cast<int>(remote_desc.devId), strerror(ret));
+            return false;
+        }
+        return true;
+    }
+
+    if (extents) {
+        const nixlPosixExtent &extent = (*extents)[idx];
+        return rwFull(is_read, extent.fd, &(*iovs)[extent.first], extent.count, extent.offset);
+    }
+
+    const nixlMetaDesc &local_desc = (*local)[idx];
+    const nixlMetaDesc &remote_desc = (*remote)[idx];
+    struct iovec iov = {reinterpret_cast<void*>(local_desc.addr), remote_desc.len};
+    return rwFull(is_read, remote_desc.devId, &iov, 1, remote_desc.addr);
+}
+
+void ThreadPoolQueue::onCompletion(unsigned idx, bool success) {
+    if (!success) {
+        // I/Os not handed out yet count as completed so the transfer ends
+        failed = true;
+        num_completed += num_entries - next_io;
+        next_io = num_entries;
+    }
+    num_completed++;
+}
+
+nixl_status_t ThreadPoolQueue::checkCompleted() {
+    if (num_completed < num_entries) {
+        return NIXL_IN_PROG;
+    }
+    return failed ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
+}
+
+bool ThreadPoolQueue::setExtents(const std::vector<nixlPosixExtent> *extents,
+                                 const std::vector<struct iovec> *iovs) {
+    this->extents = extents;
+    this->iovs = iovs;
+    num_entries = extents->size();
+    return true;
+}
+
+bool ThreadPoolQueue::setPrefetch() {
+    prefetch = true;
+    return true;
+}
+
+nixl_status_t ThreadPoolQueue::prepIO(int fd, void* buf, size_t len, off_t offset) {
+    if (fd < 0) {
+        NIXL_ERROR << "Invalid file descriptor provided to prepareIO";
+        return NIXL_ERR_BACKEND;
+    }
+
+    if (!buf || len == 0) {
+        NIXL_ERROR << "Invalid buffer or length provided to prepareIO";
+        return NIXL_ERR_BACKEND;
+    }
+    return NIXL_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef THREAD_POOL_QUEUE_H
+#define THREAD_POOL_QUEUE_H
+
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "posix_queue.h"
+#include "io_thread_pool.h"
+
+// Queue running blocking pread/pwrite on an engine-wide thread pool, for
+// filesystems where AIO and io_uring serialize the I/Os
+class ThreadPoolQueue : public nixlPosixQueue, public IoThreadPoolClient {
+    private:
+        std::shared_ptr<IoThreadPool> pool;
+        int num_entries;                   // Total number of I/Os expected
+        const int max_inflight;            // Maximal number of I/Os running at once
+        const bool is_read;
+        bool prefetch;                     // posix_fadvise(WILLNEED) instead of reads
+        unsigned next_io;                  // Next I/O to hand to a worker, under the pool lock
+        std::atomic<int> num_completed;
+        std::atomic<bool> failed;
+        const nixl_meta_dlist_t *local;    // Descriptors of the posted transfer
+        const nixl_meta_dlist_t *remote;
+        const std::vector<nixlPosixExtent> *extents;  // Coalesced I/Os, null for one per descriptor
+        const std::vector<struct iovec> *iovs;
+
+        ThreadPoolQueue(const ThreadPoolQueue&) = delete;
+        ThreadPoolQueue& operator=(const ThreadPoolQueue&) = delete;
+        ThreadPoolQueue(ThreadPoolQueue&&) = delete;
+        ThreadPoolQueue& operator=(ThreadPoolQueue&&) = delete;
+
+    public:
+        ThreadPoolQueue(int num_entries, int max_inflight, std::shared_ptr<IoThreadPool> pool,
+                        nixl_xfer_op_t operation);
+        ~ThreadPoolQueue();
+        nixl_status_t
+        submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) override;
+        nixl_status_t checkCompleted() override;
+        nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) override;
+        bool setExtents(const std::vector<nixlPosixExtent> *extents,
+                        const std::vector<struct iovec> *iovs) override;
+        bool setPrefetch() override;
+
+        void start() override;
+        bool nextIO(unsigned &idx) override;
+        bool runIO(unsigned idx) override;
+        void onCompletion(unsigned idx, bool success) override;
+};
+
+#endif // THREAD_POOL_QUEUE_H
@@ -16,13 +16,15 @@
  */
 
 #include "uring_queue.h"
+#include "posix_backend.h"
 #include <liburing.h>
+#include <fcntl.h>
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <cstring>
 #include <stdexcept>
 #include "absl/strings/str_format.h"
-#include "absl/strings/str_join.h"
 #include "common/nixl_log.h"
 
 namespace {
@@ -43,116 +45,183 @@ namespace {
                                           (completed * 100.0 / total));
         }
     }
+}
 
-    std::string stringifyUringFeatures(unsigned int features) {
-        static const std::unordered_map<unsigned int, std::string> feature_map = {
-            {IORING_FEAT_SQPOLL_NONFIXED, "SQPOLL"},
-            {IORING_FEAT_FAST_POLL, "IOPOLL"}
-        };
+UringQueue::UringQueue(int num_entries, int max_inflight, std::shared_ptr<UringRing> ring,
+                       nixl_xfer_op_t operation)
+    : ring(std::move(ring))
+    , num_entries(num_entries)
+    , max_inflight(max_inflight)
+    , num_submitted(0)
+    , num_completed(0)
+    , failed(false)
+    , local(nullptr)
+    , remote(nullptr)
+    , extents(nullptr)
+    , iovs(nullptr)
+    , is_read(operation == NIXL_READ)
+    , prefetch(false)
+    , prep_op(operation == NIXL_READ ?
+        reinterpret_cast<io_uring_prep_func_t>(io_uring_prep_read) :
+        reinterpret_cast<io_uring_prep_func_t>(io_uring_prep_write))
+    , prep_fixed_op(operation == NIXL_READ ?
+        reinterpret_cast<io_uring_prep_fixed_func_t>(io_uring_prep_read_fixed) :
+        reinterpret_cast<io_uring_prep_fixed_func_t>(io_uring_prep_write_fixed))
+{
+    if (num_entries <= 0 || max_inflight <= 0) {
+        throw std::invalid_argument("Invalid number of entries for UringQueue");
+    }
+    if (!this->ring) {
+        throw std::invalid_argument("Invalid ring for UringQueue");
+    }
+}
 
-        std::vector<std::string> enabled;
-        for (unsigned int bits = features; bits; bits &= (bits - 1)) { // step through each set bit
-            unsigned int bit = bits & -bits; // isolate lowest set bit
-            auto it = feature_map.find(bit);
-            if (it != feature_map.end()) {
-                enabled.push_back(it->second);
-            }
+UringQueue::~UringQueue() {
+    // Completions refer to this queue, they must all be reaped before it goes away
+    while (num_completed < num_submitted) {
+        if (ring->reap(true) != NIXL_SUCCESS) {
+            NIXL_ERROR << "Failed to drain in-flight I/Os of destroyed UringQueue";
+            break;
         }
-        return enabled.empty() ? "none" : absl::StrJoin(enabled, ", ");
     }
 }
 
-nixl_status_t UringQueue::init(int entries, const io_uring_params& params) {
-    // Initialize with basic setup - need a mutable copy since the API modifies the params
-    io_uring_params mutable_params = params;
-    if (io_uring_queue_init_params(entries, &uring, &mutable_params) < 0) {
-        throw std::runtime_error(absl::StrFormat("Failed to initialize io_uring instance: %s", nixl_strerror(errno)));
+void UringQueue::prepEntry(struct io_uring_sqe *sqe, const nixlMetaDesc &local_desc,
+                           const nixlMetaDesc &remote_desc) {
+    auto lmd = static_cast<const nixlPosixMetadata*>(local_desc.metadataP);
+    auto rmd = static_cast<const nixlPosixMetadata*>(remote_desc.metadataP);
+    bool fixed = ring->hasFixed();
+    void *buf = reinterpret_cast<void *>(local_desc.addr);
+
+    // Registered buffers and files save the kernel pinning and fd lookup per I/O
+    if (fixed && lmd && lmd->fixedIdx >= 0) {
+        prep_fixed_op(sqe, remote_desc.devId, buf, local_desc.len, remote_desc.addr, lmd->fixedIdx);
+    } else {
+        prep_op(sqe, remote_desc.devId, buf, local_desc.len, remote_desc.addr);
     }
 
-    // Log the features supported by this io_uring instance
-    NIXL_INFO << absl::StrFormat("io_uring features: %s", stringifyUringFeatures(mutable_params.features));
-
-    return NIXL_SUCCESS;
+    if (fixed && rmd && rmd->fixedIdx >= 0) {
+        sqe->fd = rmd->fixedIdx;
+        io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+    }
 }
 
-UringQueue::UringQueue(int num_entries, const io_uring_params& params, nixl_xfer_op_t operation)
-    : num_entries(num_entries)
-    , num_completed(0)
-    , prep_op(operation == NIXL_READ ?
-        reinterpret_cast<io_uring_prep_func_t>(io_uring_prep_read) :
-        reinterpret_cast<io_uring_prep_func_t>(io_uring_prep_write))
-{
-    if (num_entries <= 0) {
-        throw std::invalid_argument("Invalid number of entries for UringQueue");
+void UringQueue::prepExtent(struct io_uring_sqe *sqe, const nixlPosixExtent &extent) {
+    // A single descriptor keeps the registered buffer path
+    if (extent.count == 1) {
+        prepEntry(sqe, (*local)[extent.first], (*remote)[extent.first]);
+        return;
+    }
+
+    const struct iovec *vecs = &(*iovs)[extent.first];
+    if (is_read) {
+        io_uring_prep_readv(sqe, extent.fd, vecs, extent.count, extent.offset);
+    } else {
+        io_uring_prep_writev(sqe, extent.fd, vecs, extent.count, extent.offset);
     }
 
-    init(num_entries, params);
+    // All the descriptors of an extent are on the same file, so the same slot
+    auto rmd = static_cast<const nixlPosixMetadata*>((*remote)[extent.first].metadataP);
+    if (ring->hasFixed() && rmd && rmd->fixedIdx >= 0) {
+        sqe->fd = rmd->fixedIdx;
+        io_uring_sqe_set_flags(sqe, IOSQE_FIXED_FILE);
+    }
 }
 
-UringQueue::~UringQueue() {
-    io_uring_queue_exit(&uring);
+nixl_status_t UringQueue::fill() {
+    unsigned submitted;
+    nixl_status_t status;
+
+    // Keep at most max_inflight of our entries in the ring, the rest wait for completions
+    int window = max_inflight - (num_submitted - num_completed);
+    int count = std::min(num_entries - num_submitted, window);
+    if (count <= 0) {
+        return NIXL_SUCCESS;
+    }
+
+    status = ring->submit(this, count,
+        [this](struct io_uring_sqe *sqe, unsigned i) {
+            if (prefetch) {
+                const nixlMetaDesc &remote_desc = (*remote)[num_submitted + i];
+                io_uring_prep_fadvise(sqe, remote_desc.devId, remote_desc.addr, remote_desc.len,
+                                      POSIX_FADV_WILLNEED);
+            } else if (extents) {
+                prepExtent(sqe, (*extents)[num_submitted + i]);
+            } else {
+                prepEntry(sqe, (*local)[num_submitted + i], (*remote)[num_submitted + i]);
+            }
+        }, submitted);
+
+    num_submitted += submitted;
+    return status;
 }
 
 nixl_status_t
 UringQueue::submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) {
-    for (auto [local_it, remote_it] = std::make_pair (local.begin(), remote.begin());
-         local_it != local.end() && remote_it != remote.end();
-         ++local_it, ++remote_it) {
-        int fd = remote_it->devId;
-        void *buf = reinterpret_cast<void *> (local_it->addr);
-        size_t len = local_it->len;
-        off_t offset = remote_it->addr;
-
-        struct io_uring_sqe *sqe = io_uring_get_sqe (&uring);
-        if (!sqe) {
-            NIXL_ERROR << "Failed to get io_uring submission queue entry";
-            return NIXL_ERR_BACKEND;
-        }
-        prep_op (sqe, fd, buf, len, offset);
-    }
+    this->local = &local;
+    this->remote = &remote;
+    num_submitted = 0;
+    num_completed = 0;
+    failed = false;
 
-    int ret = io_uring_submit(&uring);
-    if (ret != num_entries) {
-        if (ret < 0) {
-            NIXL_ERROR << absl::StrFormat("io_uring submit failed: %s", nixl_strerror(-ret));
-        } else {
-            NIXL_ERROR << absl::StrFormat("io_uring submit failed. Partial submission: %d/%d", num_entries, ret);
-        }
-        return NIXL_ERR_BACKEND;
+    // Entries that don't fit in the ring now are submitted from checkCompleted
+    nixl_status_t status = fill();
+    if (status != NIXL_SUCCESS) {
+        return status;
     }
-    num_completed = 0;
     return NIXL_IN_PROG;
 }
 
 nixl_status_t UringQueue::checkCompleted() {
     if (num_completed == num_entries) {
-        return NIXL_SUCCESS;
+        return failed ? NIXL_ERR_BACKEND : NIXL_SUCCESS;
     }
 
-    // Process all available completions
-    struct io_uring_cqe* cqe;
-    unsigned head;
-    unsigned count = 0;
+    // Completions of other queues sharing the ring are dispatched to them
+    nixl_status_t status = ring->reap();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
 
-    // Get completion events
-    io_uring_for_each_cqe(&uring, head, cqe) {
-        int res = cqe->res;
-        if (res < 0) {
-            NIXL_ERROR << absl::StrFormat("IO operation failed: %s", nixl_strerror(-res));
-            return NIXL_ERR_BACKEND;
-        }
-        count++;
+    if (failed) {
+        return NIXL_ERR_BACKEND;
     }
 
-    // Mark all seen
-    io_uring_cq_advance(&uring, count);
-    num_completed += count;
+    status = fill();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
 
     logOnPercentStep(num_completed, num_entries);
 
     return (num_completed == num_entries) ? NIXL_SUCCESS : NIXL_IN_PROG;
 }
 
+void UringQueue::onCompletion(int res) {
+    if (res < 0) {
+        NIXL_ERROR << absl::StrFormat("IO operation failed: %s", nixl_strerror(-res));
+        failed = true;
+    }
+    num_completed++;
+}
+
+bool UringQueue::setExtents(const std::vector<nixlPosixExtent> *extents,
+                            const std::vector<struct iovec> *iovs) {
+    this->extents = extents;
+    this->iovs = iovs;
+    num_entries = extents->size();
+    return true;
+}
+
+bool UringQueue::setPrefetch() {
+    // Polled rings only support reads and writes
+    if (ring->getSetupFlags() & IORING_SETUP_IOPOLL) {
+        return false;
+    }
+    prefetch = true;
+    return true;
+}
+
 nixl_status_t UringQueue::prepIO(int fd, void* buf, size_t len, off_t offset) {
     return NIXL_SUCCESS;
 }
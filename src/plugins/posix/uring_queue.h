@@ -14,12 +14,14 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
-
 #ifndef URING_QUEUE_H
 #define URING_QUEUE_H
 
+#include <atomic>
+#include <memory>
 #include <liburing.h>
 #include "posix_queue.h"
+#include "uring_ring.h"
 #include <absl/strings/str_format.h>
 
 // Forward declare Error class
@@ -27,16 +29,31 @@ class nixlPosixBackendReqH;
 
 // Type definition for io_uring prep functions
 typedef void (*io_uring_prep_func_t)(struct io_uring_sqe*, int, const void*, unsigned int, __u64);
+typedef void (*io_uring_prep_fixed_func_t)(struct io_uring_sqe*, int, const void*, unsigned int, __u64, int);
 
-class UringQueue : public nixlPosixQueue {
+class UringQueue : public nixlPosixQueue, public UringRingClient {
     private:
-        struct io_uring uring;         // The io_uring instance for async I/O operations
-        const int num_entries;         // Total number of entries expected in this ring
-        int num_completed;             // Number of completed operations so far
-        io_uring_prep_func_t prep_op;  // Pointer to prep function
+        std::shared_ptr<UringRing> ring;          // Ring the I/Os are submitted to
+        int num_entries;                          // Total number of I/Os expected in this queue
+        const int max_inflight;                   // Maximal number of entries in flight at once
+        int num_submitted;                        // Number of entries handed to the ring so far
+        std::atomic<int> num_completed;           // Number of completed operations so far
+        std::atomic<bool> failed;                 // Set if any operation failed
+        const nixl_meta_dlist_t *local;           // Descriptors of the posted transfer
+        const nixl_meta_dlist_t *remote;
+        const std::vector<nixlPosixExtent> *extents;  // Coalesced I/Os, null for one per descriptor
+        const std::vector<struct iovec> *iovs;
+        const bool is_read;
+        bool prefetch;                            // FADVISE_WILLNEED instead of reads
+        io_uring_prep_func_t prep_op;             // Pointer to prep function
+        io_uring_prep_fixed_func_t prep_fixed_op; // Prep function for registered buffers
+
+        void prepEntry(struct io_uring_sqe *sqe, const nixlMetaDesc &local_desc,
+                       const nixlMetaDesc &remote_desc);
+        void prepExtent(struct io_uring_sqe *sqe, const nixlPosixExtent &extent);
 
-        // Initialize the queue with the given parameters
-        nixl_status_t init(int num_entries, const struct io_uring_params& params);
+        // Hand as many of the remaining entries to the ring as it has room for
+        nixl_status_t fill();
 
         // Delete copy and move operations to prevent accidental copying of kernel resources
         UringQueue(const UringQueue&) = delete;
@@ -45,12 +62,17 @@ class UringQueue : public nixlPosixQueue {
         UringQueue& operator=(UringQueue&&) = delete;
 
     public:
-        UringQueue(int num_entries, const struct io_uring_params& params, nixl_xfer_op_t operation);
+        UringQueue(int num_entries, int max_inflight, std::shared_ptr<UringRing> ring,
+                   nixl_xfer_op_t operation);
         ~UringQueue();
         nixl_status_t
         submit (const nixl_meta_dlist_t &local, const nixl_meta_dlist_t &remote) override;
         nixl_status_t checkCompleted() override;
         nixl_status_t prepIO(int fd, void* buf, size_t len, off_t offset) override;
+        bool setExtents(const std::vector<nixlPosixExtent> *extents,
+                        const std::vector<struct iovec> *iovs) override;
+        bool setPrefetch() override;
+        void onCompletion(int res) override;
 };
 
 #endif // URING_QUEUE_H
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "uring_ring.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "absl/strings/str_format.h"
+#include "absl/strings/str_join.h"
+#include "common/nixl_log.h"
+
+namespace {
+    std::string stringifyUringFeatures(unsigned int features) {
+        static const std::unordered_map<unsigned int, std::string> feature_map = {
+            {IORING_FEAT_SQPOLL_NONFIXED, "SQPOLL"},
+            {IORING_FEAT_FAST_POLL, "IOPOLL"}
+        };
+
+        std::vector<std::string> enabled;
+        for (unsigned int bits = features; bits; bits &= (bits - 1)) { // step through each set bit
+            unsigned int bit = bits & -bits; // isolate lowest set bit
+            auto it = feature_map.find(bit);
+            if (it != feature_map.end()) {
+                enabled.push_back(it->second);
+            }
+        }
+        return enabled.empty() ? "none" : absl::StrJoin(enabled, ", ");
+    }
+}
+
+UringRing::UringRing(unsigned depth, const io_uring_params& params)
+    : depth(depth)
+    , in_flight(0)
+    , unsubmitted(0)
+    , fixed(false)
+    , setup_flags(params.flags)
+    , features(0)
+{
+    if (depth == 0) {
+        throw std::invalid_argument("Invalid depth for UringRing");
+    }
+
+    // Need a mutable copy since the API modifies the params
+    io_uring_params mutable_params = params;
+    int ret = io_uring_queue_init_params(depth, &uring, &mutable_params);
+    if (ret < 0) {
+        throw std::runtime_error(absl::StrFormat("Failed to initialize io_uring instance: %s",
+                                                 nixl_strerror(-ret)));
+    }
+
+    features = mutable_params.features;
+
+    // Log the features supported by this io_uring instance
+    NIXL_INFO << absl::StrFormat("io_uring features: %s", stringifyUringFeatures(mutable_params.features));
+}
+
+UringRing::~UringRing() {
+    if (in_flight > 0) {
+        NIXL_ERROR << "Programming error: Destroying UringRing with " << in_flight << " in-flight I/Os";
+    }
+    io_uring_queue_exit(&uring);
+}
+
+bool UringRing::initFixed(unsigned num_files, unsigned num_buffers) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    // Sparse tables need Linux 5.19, slots are filled as memory is registered
+    int ret = io_uring_register_files_sparse(&uring, num_files);
+    if (ret < 0) {
+        NIXL_INFO << absl::StrFormat("io_uring registered files not supported: %s", nixl_strerror(-ret));
+        return false;
+    }
+
+    ret = io_uring_register_buffers_sparse(&uring, num_buffers);
+    if (ret < 0) {
+        NIXL_INFO << absl::StrFormat("io_uring registered buffers not supported: %s", nixl_strerror(-ret));
+        io_uring_unregister_files(&uring);
+        return false;
+    }
+
+    fixed = true;
+    return true;
+}
+
+void UringRing::disableFixed() {
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (fixed) {
+        io_uring_unregister_files(&uring);
+        io_uring_unregister_buffers(&uring);
+        fixed = false;
+    }
+}
+
+bool UringRing::setFixedFile(unsigned idx, int fd) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    int ret = io_uring_register_files_update(&uring, idx, &fd, 1);
+    if (ret < 0) {
+        NIXL_DEBUG << absl::StrFormat("Failed to update registered file %u: %s", idx, nixl_strerror(-ret));
+        return false;
+    }
+    return true;
+}
+
+bool UringRing::setFixedBuffer(unsigned idx, const struct iovec &iov) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    int ret = io_uring_register_buffers_update_tag(&uring, idx, &iov, nullptr, 1);
+    if (ret < 0) {
+        // Typically RLIMIT_MEMLOCK or a buffer larger than 1GB
+        NIXL_DEBUG << absl::StrFormat("Failed to update registered buffer %u: %s", idx, nixl_strerror(-ret));
+        return false;
+    }
+    return true;
+}
+
+nixl_status_t UringRing::flush() {
+    if (unsubmitted == 0) {
+        return NIXL_SUCCESS;
+    }
+
+    int ret = io_uring_submit(&uring);
+    if (ret < 0) {
+        // The kernel is short on resources, SQEs stay queued for the next attempt
+        if (ret == -EAGAIN || ret == -EBUSY) {
+            return NIXL_SUCCESS;
+        }
+        NIXL_ERROR << absl::StrFormat("io_uring submit failed: %s", nixl_strerror(-ret));
+        return NIXL_ERR_BACKEND;
+    }
+
+    unsubmitted -= std::min(unsubmitted, static_cast<unsigned>(ret));
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t
+UringRing::submit(UringRingClient *client, unsigned count,
+                  const std::function<void(struct io_uring_sqe*, unsigned)> &prep,
+                  unsigned &submitted) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    submitted = 0;
+    count = std::min(count, depth - in_flight);
+    for (; submitted < count; submitted++) {
+        struct io_uring_sqe *sqe = io_uring_get_sqe(&uring);
+        if (!sqe) {
+            break;
+        }
+        prep(sqe, submitted);
+        io_uring_sqe_set_data(sqe, client);
+    }
+
+    in_flight += submitted;
+    unsubmitted += submitted;
+    return flush();
+}
+
+nixl_status_t UringRing::reap(bool wait) {
+    std::lock_guard<std::mutex> guard(lock);
+    struct io_uring_cqe *cqe;
+    unsigned head;
+    unsigned count = 0;
+
+    nixl_status_t status = flush();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    // Polled rings only find completions when entering the kernel, peek does
+    // that without blocking when the CQ is empty
+    if (!wait && in_flight > 0 && (setup_flags & IORING_SETUP_IOPOLL)) {
+        int ret = io_uring_peek_cqe(&uring, &cqe);
+        if (ret < 0 && ret != -EAGAIN) {
+            NIXL_ERROR << absl::StrFormat("io_uring poll failed: %s", nixl_strerror(-ret));
+            return NIXL_ERR_BACKEND;
+        }
+    }
+
+    if (wait && in_flight > 0) {
+        int ret = io_uring_wait_cqe(&uring, &cqe);
+        if (ret < 0) {
+            NIXL_ERROR << absl::StrFormat("io_uring wait failed: %s", nixl_strerror(-ret));
+            return NIXL_ERR_BACKEND;
+        }
+    }
+
+    io_uring_for_each_cqe(&uring, head, cqe) {
+        auto client = static_cast<UringRingClient*>(io_uring_cqe_get_data(cqe));
+        client->onCompletion(cqe->res);
+        count++;
+    }
+
+    io_uring_cq_advance(&uring, count);
+    in_flight -= count;
+    return NIXL_SUCCESS;
+}
@@ -0,0 +1,82 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef URING_RING_H
+#define URING_RING_H
+
+#include <liburing.h>
+#include <sys/uio.h>
+#include <functional>
+#include <mutex>
+#include "nixl_types.h"
+
+// Receives the completions of the I/Os it submitted to a UringRing
+class UringRingClient {
+    public:
+        virtual ~UringRingClient() = default;
+        virtual void onCompletion(int res) = 0;
+};
+
+// io_uring instance with a fixed queue depth that can be shared by many queues.
+// Each SQE carries its client in user_data and reap() dispatches the CQEs to
+// their clients, whichever queue reaps them.
+class UringRing {
+    private:
+        struct io_uring uring;   // The io_uring instance for async I/O operations
+        const unsigned depth;    // Maximal number of I/Os in flight
+        unsigned in_flight;      // I/Os prepared and not yet completed
+        unsigned unsubmitted;    // I/Os prepared but not accepted by the kernel yet
+        bool fixed;              // Registered file and buffer tables are set up
+        unsigned setup_flags;    // IORING_SETUP_* flags the ring was created with
+        unsigned features;       // IORING_FEAT_* flags reported by the kernel
+        std::mutex lock;
+
+        nixl_status_t flush();
+
+        UringRing(const UringRing&) = delete;
+        UringRing& operator=(const UringRing&) = delete;
+        UringRing(UringRing&&) = delete;
+        UringRing& operator=(UringRing&&) = delete;
+
+    public:
+        UringRing(unsigned depth, const struct io_uring_params& params);
+        ~UringRing();
+
+        unsigned getDepth() const { return depth; }
+        unsigned getSetupFlags() const { return setup_flags; }
+        unsigned getFeatures() const { return features; }
+
+        // Set up empty tables of registered files and buffers, returns false if
+        // the kernel doesn't support them and plain operations have to be used
+        bool initFixed(unsigned num_files, unsigned num_buffers);
+        bool hasFixed() const { return fixed; }
+        void disableFixed();
+
+        // Fill or clear (fd -1, null iov_base) a slot of the registered tables
+        bool setFixedFile(unsigned idx, int fd);
+        bool setFixedBuffer(unsigned idx, const struct iovec &iov);
+
+        // Prepare up to count SQEs with prep(sqe, i) and submit them. Only as many
+        // as there are free slots are queued, their number is returned in submitted.
+        nixl_status_t submit(UringRingClient *client, unsigned count,
+                             const std::function<void(struct io_uring_sqe*, unsigned)> &prep,
+                             unsigned &submitted);
+
+        // Dispatch all available completions, if wait is set block until at least one
+        nixl_status_t reap(bool wait = false);
+};
+
+#endif // URING_RING_H
@@ -24,6 +24,8 @@
 #include <limits>
 #include <string.h>
 #include <unistd.h>
+#include <pthread.h>
+#include <sched.h>
 #include "absl/strings/numbers.h"
 
 #ifdef HAVE_CUDA
@@ -312,6 +314,41 @@ static void _internalRequestReset(nixlUcxIntReq *req) {
  * Backend request management
 *****************************************/
 
+// Flush request shared by all handles posted together to the same endpoint.
+// The UCX request is released once the last handle drops its reference.
+class nixlUcxSharedFlush {
+private:
+    nixlUcxWorker &uw;
+    nixlUcxIntReq *req;
+    std::atomic<bool> done;
+
+public:
+    nixlUcxSharedFlush(nixlUcxWorker &uw_, nixlUcxReq req_)
+        : uw(uw_), req((nixlUcxIntReq*)req_), done(false) {}
+
+    ~nixlUcxSharedFlush()
+    {
+        if (!done) {
+            uw.reqCancel((nixlUcxReq)req);
+        }
+        _internalRequestReset(req);
+        uw.reqRelease((nixlUcxReq)req);
+    }
+
+    nixl_status_t status()
+    {
+        if (done) {
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t ret = ucx_status_to_nixl(ucp_request_check_status((nixlUcxReq)req));
+        if (ret == NIXL_SUCCESS) {
+            done = true;
+        }
+        return ret;
+    }
+};
+
 class nixlUcxBackendH : public nixlBackendReqH {
 private:
     nixlUcxIntReq head;
@@ -327,21 +364,45 @@ private:
     };
     std::optional<Notif> notif;
 
+    // Shape and post time of the transfer, to calibrate the cost model
+    struct CostSample {
+        std::string agent;
+        size_t bytes;
+        size_t descs;
+        std::chrono::steady_clock::time_point start;
+        bool pending = false;
+        CostSample(const std::string& remote_agent, size_t bytes_, size_t descs_)
+            : agent(remote_agent), bytes(bytes_), descs(descs_) {}
+    };
+    std::optional<CostSample> cost;
+
+    // Flushes shared with other handles of the same batch
+    std::vector<std::shared_ptr<nixlUcxSharedFlush>> flushes;
+
 public:
     auto& notification() {
         return notif;
     }
 
+    auto& costSample() {
+        return cost;
+    }
+
     nixlUcxBackendH(const nixlUcxEngine &eng_, size_t worker_id_): eng(eng_), worker_id(worker_id_) {}
 
     void append(nixlUcxIntReq *req) {
         head.link(req);
     }
 
+    void appendFlush(const std::shared_ptr<nixlUcxSharedFlush> &flush) {
+        flushes.push_back(flush);
+    }
+
     nixl_status_t release()
     {
         nixlUcxIntReq *req = head.next();
 
+        flushes.clear();
         if (!req) {
             return NIXL_SUCCESS;
         }
@@ -369,7 +430,7 @@ public:
         nixlUcxIntReq *req = head.next();
         nixl_status_t out_ret = NIXL_SUCCESS;
 
-        if (NULL == req) {
+        if ((NULL == req) && flushes.empty()) {
             /* No pending transmissions */
             return NIXL_SUCCESS;
         }
@@ -379,6 +440,20 @@ public:
         /* Maximum progress */
         while (uw->progress());
 
+        /* Shared flushes are dropped once completed */
+        for (auto it = flushes.begin(); it != flushes.end();) {
+            nixl_status_t ret = (*it)->status();
+            if (ret == NIXL_SUCCESS) {
+                it = flushes.erase(it);
+                continue;
+            }
+            if (ret != NIXL_IN_PROG) {
+                return ret;
+            }
+            out_ret = NIXL_IN_PROG;
+            ++it;
+        }
+
         /* Go over all request updating their status */
         while(req) {
             nixl_status_t ret;
@@ -427,12 +502,54 @@ public:
  * Progress thread management
 *****************************************/
 
+// Progress all workers until there was no activity for pthrBusyPoll.
+// Returns true if the thread was signalled to stop meanwhile.
+bool nixlUcxEngine::progressBusyPoll()
+{
+    constexpr unsigned ctrlCheckInterval = 1024;
+    auto last_activity = std::chrono::steady_clock::now();
+    unsigned iter = 0;
+
+    while (std::chrono::steady_clock::now() - last_activity < pthrBusyPoll) {
+        bool made_progress = false;
+        for (size_t wid = 0; wid < uws.size(); wid++) {
+            bool worker_progress = false;
+            while (uws[wid]->progress())
+                worker_progress = true;
+
+            if (worker_progress && !wid)
+                notifProgress();
+            made_progress |= worker_progress;
+        }
+
+        if (made_progress)
+            last_activity = std::chrono::steady_clock::now();
+
+        // Checking control pipe costs a syscall, don't do it on each iteration
+        if ((++iter % ctrlCheckInterval == 0) &&
+            (poll(&pollFds.back(), 1, 0) > 0) && (pollFds.back().revents & POLLIN))
+            return true;
+    }
+
+    return false;
+}
+
 void nixlUcxEngine::progressFunc()
 {
     using namespace nixlTime;
 
     vramApplyCtx();
 
+    if (pthrCpu >= 0) {
+        cpu_set_t cpuset;
+        CPU_ZERO(&cpuset);
+        CPU_SET(pthrCpu, &cpuset);
+        int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+        if (ret)
+            NIXL_ERROR << "Failed to pin progress thread to CPU " << pthrCpu
+                       << ": " << strerror(ret);
+    }
+
     {
         std::unique_lock<std::mutex> lock(pthrActiveLock);
         pthrActive = true;
@@ -442,31 +559,56 @@ void nixlUcxEngine::progressFunc()
     // Set timeout event so that the main loop would progress all workers on first iteration
     bool timeout = true;
     bool pthrStop = false;
+    bool active = false;
     while (!pthrStop) {
+        // After recent activity more is likely to follow, spin for a while
+        // to avoid paying for arm and wakeup on each of them
+        if (active && (pthrBusyPoll.count() > 0)) {
+            if (progressBusyPoll()) {
+                pthrStop = true;
+                break;
+            }
+            // Workers were not armed while spinning, go over all of them
+            timeout = true;
+        }
+        active = false;
+
         for (size_t wid = 0; wid < pollFds.size() - 1; wid++) {
             if (!(pollFds[wid].revents & POLLIN) && !timeout)
                 continue;
             pollFds[wid].revents = 0;
 
             bool made_progress = false;
-            ucs_status_t status = UCS_INPROGRESS;
             const auto &uw = uws[wid];
-            do {
-                while (uw->progress())
-                    made_progress = true;
-
-                status = ucp_worker_arm(uw->getWorker());
-            } while (status == UCS_ERR_BUSY);
-            NIXL_ASSERT(status == UCS_OK);
+            while (uw->progress())
+                made_progress = true;
+
+            // No need to arm a worker when going straight to busy polling,
+            // the sweep after it arms all of them
+            if (!made_progress || (pthrBusyPoll.count() == 0)) {
+                ucs_status_t status;
+                while ((status = ucp_worker_arm(uw->getWorker())) == UCS_ERR_BUSY) {
+                    while (uw->progress())
+                        made_progress = true;
+                }
+                NIXL_ASSERT(status == UCS_OK);
+            }
 
             if (made_progress && !wid)
                 notifProgress();
+            active |= made_progress;
         }
         timeout = false;
 
+        // Spin right away instead of paying for a wakeup on the next completion
+        if (active && (pthrBusyPoll.count() > 0))
+            continue;
+
         int ret;
         while ((ret = poll(pollFds.data(), pollFds.size(), pthrDelay.count())) < 0)
             NIXL_PTRACE << "Call to poll() was interrupted, retrying";
+        if (ret > 0)
+            pthrWakeups.fetch_add(1, std::memory_order_relaxed);
 
         if (!ret) {
             timeout = true;
@@ -549,6 +691,24 @@ nixlUcxEngine::nixlUcxEngine (const nixlBackendInitParams* init_params)
         pthrDelay = std::chrono::ceil<std::chrono::milliseconds>(
             std::chrono::microseconds(init_params->pthrDelay < std::numeric_limits<int>::max() ?
                                       init_params->pthrDelay : std::numeric_limits<int>::max()));
+
+        uint64_t busy_poll_us = 0;
+        const auto busy_poll_it = custom_params->find("ucx_pt_busy_poll_us");
+        if (busy_poll_it != custom_params->end() &&
+            !absl::SimpleAtoi(busy_poll_it->second, &busy_poll_us)) {
+            NIXL_ERROR << "Invalid ucx_pt_busy_poll_us value: " << busy_poll_it->second;
+            this->initErr = true;
+            return;
+        }
+        pthrBusyPoll = std::chrono::microseconds(busy_poll_us);
+
+        pthrCpu = -1;
+        const auto cpu_it = custom_params->find("ucx_pt_cpu");
+        if (cpu_it != custom_params->end() && !absl::SimpleAtoi(cpu_it->second, &pthrCpu)) {
+            NIXL_ERROR << "Invalid ucx_pt_cpu value: " << cpu_it->second;
+            this->initErr = true;
+            return;
+        }
     } else {
         pthrOn = false;
     }
@@ -560,6 +720,12 @@ nixlUcxEngine::nixlUcxEngine (const nixlBackendInitParams* init_params)
     if (num_workers_iter == custom_params->end() || !absl::SimpleAtoi(num_workers_iter->second, &numWorkers))
         numWorkers = 1;
 
+    const auto cost_calib_it = custom_params->find("ucx_cost_calibration");
+    if ((cost_calib_it != custom_params->end()) && (cost_calib_it->second == "true")) {
+        // Roughly the last 20 transfers of each class dominate the estimate
+        costModel = std::make_unique<nixlUcxCostModel>(0.95);
+    }
+
     const auto err_handling_mode_it =
             custom_params->find("ucx_error_handling_mode");
     ucp_err_handling_mode_t err_handling_mode = UCP_ERR_HANDLING_MODE_NONE;
@@ -956,6 +1122,13 @@ nixl_status_t nixlUcxEngine::prepXfer (const nixl_xfer_op_t &operation,
     /* TODO: try to get from a pool first */
     nixlUcxBackendH *intHandle = new nixlUcxBackendH(*this, getWorkerId());
 
+    if (costModel) {
+        size_t bytes = 0;
+        for (int i = 0; i < local.descCount(); i++)
+            bytes += local[i].len;
+        intHandle->costSample().emplace(remote_agent, bytes, local.descCount());
+    }
+
     handle = (nixlBackendReqH*)intHandle;
     return NIXL_SUCCESS;
 }
@@ -1013,21 +1186,28 @@ nixl_status_t nixlUcxEngine::estimateXferCost (const nixl_xfer_op_t &operation,
         method = msg_method;
     }
 
+    // Replace the analytical estimate once enough transfers were observed
+    if (costModel) {
+        size_t bytes = 0;
+        for (int i = 0; i < local.descCount(); i++)
+            bytes += local[i].len;
+
+        if (costModel->estimate(remote_agent, bytes, local.descCount(), duration, err_margin))
+            method = nixl_cost_t::CALIBRATED_BACKEND;
+    }
+
     return NIXL_SUCCESS;
 }
 
-nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
-                                       const nixl_meta_dlist_t &local,
-                                       const nixl_meta_dlist_t &remote,
-                                       const std::string &remote_agent,
-                                       nixlBackendReqH* &handle,
-                                       const nixl_opt_b_args_t* opt_args) const
+nixl_status_t nixlUcxEngine::sendXferOps(const nixl_xfer_op_t &operation,
+                                          const nixl_meta_dlist_t &local,
+                                          const nixl_meta_dlist_t &remote,
+                                          nixlUcxBackendH *intHandle) const
 {
     size_t lcnt = local.descCount();
     size_t rcnt = remote.descCount();
     size_t i;
     nixl_status_t ret;
-    nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
     nixlUcxPrivateMetadata *lmd;
     nixlUcxPublicMetadata *rmd;
     nixlUcxReq req;
@@ -1037,6 +1217,12 @@ nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
         return NIXL_ERR_INVALID_PARAM;
     }
 
+    auto &cost = intHandle->costSample();
+    if (cost) {
+        cost->start   = std::chrono::steady_clock::now();
+        cost->pending = true;
+    }
+
     for(i = 0; i < lcnt; i++) {
         void *laddr = (void*) local[i].addr;
         size_t lsize = local[i].len;
@@ -1066,20 +1252,65 @@ nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
         }
     }
 
-    /*
-     * Flush keeps intHandle non-empty until the operation is actually
-     * completed, which can happen after local requests completion.
-     */
-    rmd = (nixlUcxPublicMetadata*) remote[0].metadataP;
-    ret = rmd->conn->getEp(workerId)->flushEp(req);
+    return NIXL_SUCCESS;
+}
+
+nixl_status_t nixlUcxEngine::sendRemoteCounterOp(const nixl_opt_b_args_t* opt_args,
+                                                 nixlUcxBackendH *intHandle) const
+{
+    nixl_status_t ret;
+    nixlUcxReq req;
+    size_t workerId = intHandle->getWorkerId();
+
+    if (!opt_args || !opt_args->hasRemoteCounter) {
+        return NIXL_SUCCESS;
+    }
+
+    // Fence orders the increment after the data, which is cheaper than
+    // waiting for the flush round trip before issuing it
+    ret = getWorker(workerId)->fence();
+    if (ret != NIXL_SUCCESS) {
+        intHandle->release();
+        return ret;
+    }
+
+    nixlUcxPublicMetadata *rmd = (nixlUcxPublicMetadata*) opt_args->remoteCounter.metadataP;
+    ret = rmd->conn->getEp(workerId)->atomicAdd(1, opt_args->remoteCounter.addr,
+                                                rmd->getRkey(workerId), req);
     if (_retHelper(ret, intHandle, req)) {
         return ret;
     }
 
+    return NIXL_SUCCESS;
+}
+
+void nixlUcxEngine::costModelRecord(nixlUcxBackendH *intHandle, nixl_status_t status) const
+{
+    auto &cost = intHandle->costSample();
+
+    if (!cost || !cost->pending || (status != NIXL_SUCCESS)) {
+        return;
+    }
+
+    // Completion time is as observed by the caller, so it includes polling delays
+    costModel->record(cost->agent, cost->bytes, cost->descs,
+                      std::chrono::duration_cast<std::chrono::microseconds>(
+                          std::chrono::steady_clock::now() - cost->start));
+    cost->pending = false;
+}
+
+nixl_status_t nixlUcxEngine::finishXferPost(const std::string &remote_agent,
+                                            const nixl_opt_b_args_t* opt_args,
+                                            nixlUcxBackendH *intHandle) const
+{
+    nixl_status_t ret;
+    nixlUcxReq req;
+
     ret = intHandle->status();
     if (opt_args && opt_args->hasNotif) {
         if (ret == NIXL_SUCCESS) {
-            ret = notifSendPriv(remote_agent, opt_args->notifMsg, req, workerId);
+            ret = notifSendPriv(remote_agent, opt_args->notifMsg, req,
+                                intHandle->getWorkerId());
             if (_retHelper(ret, intHandle, req)) {
                 return ret;
             }
@@ -1090,6 +1321,108 @@ nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
         }
     }
 
+    costModelRecord(intHandle, ret);
+    return ret;
+}
+
+nixl_status_t nixlUcxEngine::postXfer (const nixl_xfer_op_t &operation,
+                                       const nixl_meta_dlist_t &local,
+                                       const nixl_meta_dlist_t &remote,
+                                       const std::string &remote_agent,
+                                       nixlBackendReqH* &handle,
+                                       const nixl_opt_b_args_t* opt_args) const
+{
+    nixl_status_t ret;
+    nixlUcxBackendH *intHandle = (nixlUcxBackendH *)handle;
+    nixlUcxPublicMetadata *rmd;
+    nixlUcxReq req;
+    size_t workerId = intHandle->getWorkerId();
+
+    ret = sendXferOps(operation, local, remote, intHandle);
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+
+    ret = sendRemoteCounterOp(opt_args, intHandle);
+    if (ret != NIXL_SUCCESS) {
+        return ret;
+    }
+
+    /*
+     * Flush keeps intHandle non-empty until the operation is actually
+     * completed, which can happen after local requests completion.
+     */
+    rmd = (nixlUcxPublicMetadata*) remote[0].metadataP;
+    ret = rmd->conn->getEp(workerId)->flushEp(req);
+    if (_retHelper(ret, intHandle, req)) {
+        return ret;
+    }
+
+    return finishXferPost(remote_agent, opt_args, intHandle);
+}
+
+nixl_status_t nixlUcxEngine::postXferBatch(nixl_b_batch_t &batch) const
+{
+    std::unordered_map<nixlUcxEp*, std::vector<nixlBackendXferBatchElem*>> epGroups;
+    nixl_status_t ret = NIXL_SUCCESS;
+
+    for (auto &elm : batch) {
+        nixlUcxBackendH *intHandle = (nixlUcxBackendH *)elm.handle;
+        nixlUcxPublicMetadata *rmd;
+
+        elm.status = sendXferOps(elm.operation, *elm.local, *elm.remote, intHandle);
+        if (elm.status == NIXL_SUCCESS) {
+            elm.status = sendRemoteCounterOp(&elm.optArgs, intHandle);
+        }
+        if (elm.status != NIXL_SUCCESS) {
+            continue;
+        }
+
+        // Endpoints are per worker, so a group also shares the worker
+        rmd = (nixlUcxPublicMetadata*) (*elm.remote)[0].metadataP;
+        epGroups[rmd->conn->getEp(intHandle->getWorkerId()).get()].push_back(&elm);
+    }
+
+    /*
+     * A single flush per endpoint covers all the operations posted to it,
+     * each handle of the group keeps a reference until it completes.
+     */
+    for (auto &[ep, elms] : epGroups) {
+        nixlUcxBackendH *firstHandle = (nixlUcxBackendH *)elms.front()->handle;
+        std::shared_ptr<nixlUcxSharedFlush> flush;
+        nixlUcxReq req;
+
+        nixl_status_t flush_ret = ep->flushEp(req);
+        if (flush_ret == NIXL_IN_PROG) {
+            flush = std::make_shared<nixlUcxSharedFlush>(
+                        *getWorker(firstHandle->getWorkerId()), req);
+        }
+
+        for (auto elm : elms) {
+            nixlUcxBackendH *intHandle = (nixlUcxBackendH *)elm->handle;
+
+            if ((flush_ret != NIXL_SUCCESS) && (flush_ret != NIXL_IN_PROG)) {
+                intHandle->release();
+                elm->status = NIXL_ERR_BACKEND;
+                continue;
+            }
+
+            if (flush) {
+                intHandle->appendFlush(flush);
+            }
+            elm->status = finishXferPost(*elm->remoteAgent, &elm->optArgs, intHandle);
+        }
+    }
+
+    for (auto &elm : batch) {
+        if (elm.status < 0) {
+            if (ret >= 0)
+                ret = elm.status;
+        } else if ((elm.status == NIXL_IN_PROG) && (ret == NIXL_SUCCESS)) {
+            ret = NIXL_IN_PROG;
+        }
+    }
+
     return ret;
 }
 
@@ -1111,6 +1444,7 @@ nixl_status_t nixlUcxEngine::checkXfer (nixlBackendReqH* handle) const
         status = intHandle->status();
     }
 
+    costModelRecord(intHandle, status);
     return status;
 }
 
@@ -35,6 +35,7 @@
 // Local includes
 #include "common/nixl_time.h"
 #include "ucx/ucx_utils.h"
+#include "ucx_cost_model.h"
 #include "common/list_elem.h"
 
 enum ucx_cb_op_t {CONN_CHECK, NOTIF_STR, DISCONNECT};
@@ -99,6 +100,8 @@ class nixlUcxCudaCtx;
 class nixlUcxCudaDevicePrimaryCtx;
 using nixlUcxCudaDevicePrimaryCtxPtr = std::shared_ptr<nixlUcxCudaDevicePrimaryCtx>;
 
+class nixlUcxBackendH;
+
 class nixlUcxEngine
     : public nixlBackendEngine {
     private:
@@ -106,6 +109,8 @@ class nixlUcxEngine
         std::shared_ptr<nixlUcxContext> uc;
         std::vector<std::unique_ptr<nixlUcxWorker>> uws;
         std::string workerAddr;
+        // Learns transfer costs from completed transfers, if enabled
+        std::unique_ptr<nixlUcxCostModel> costModel;
 
         /* Progress thread data */
         std::mutex pthrActiveLock;
@@ -114,6 +119,12 @@ class nixlUcxEngine
         bool pthrOn;
         std::thread pthr;
         std::chrono::milliseconds pthrDelay;
+        // Keep spinning for this long after the last activity before arming
+        std::chrono::microseconds pthrBusyPoll;
+        // CPU to pin the progress thread to, negative to leave unpinned
+        int pthrCpu;
+        // Number of times the progress thread was woken up from poll() by an event
+        std::atomic<uint64_t> pthrWakeups{0};
         int pthrControlPipe[2];
         std::vector<pollfd> pollFds;
 
@@ -142,6 +153,7 @@ class nixlUcxEngine
         // Threading infrastructure
         //   TODO: move the thread management one outside of NIXL common infra
         void progressFunc();
+        bool progressBusyPoll();
         void progressThreadStart();
         void progressThreadStop();
         void progressThreadRestart();
@@ -177,6 +189,18 @@ class nixlUcxEngine
                                     nixlUcxReq &req,
                                     size_t worker_id) const;
         void notifProgress();
+
+        // Transfer helpers shared by single and batched post
+        nixl_status_t sendXferOps(const nixl_xfer_op_t &operation,
+                                  const nixl_meta_dlist_t &local,
+                                  const nixl_meta_dlist_t &remote,
+                                  nixlUcxBackendH *intHandle) const;
+        nixl_status_t sendRemoteCounterOp(const nixl_opt_b_args_t* opt_args,
+                                          nixlUcxBackendH *intHandle) const;
+        void costModelRecord(nixlUcxBackendH *intHandle, nixl_status_t status) const;
+        nixl_status_t finishXferPost(const std::string &remote_agent,
+                                     const nixl_opt_b_args_t* opt_args,
+                                     nixlUcxBackendH *intHandle) const;
         void notifProgressCombineHelper(notif_list_t &src, notif_list_t &tgt);
 
     public:
@@ -187,6 +211,7 @@ class nixlUcxEngine
         bool supportsLocal() const override { return true; }
         bool supportsNotif() const override { return true; }
         bool supportsProgTh() const override { return pthrOn; }
+        bool supportsRemoteCounter() const override { return true; }
 
         nixl_mem_list_t getSupportedMems() const override;
 
@@ -239,11 +264,17 @@ class nixlUcxEngine
                                 nixlBackendReqH* &handle,
                                 const nixl_opt_b_args_t* opt_args=nullptr) const override;
 
+        nixl_status_t postXferBatch(nixl_b_batch_t &batch) const override;
+
         nixl_status_t checkXfer (nixlBackendReqH* handle) const override;
         nixl_status_t releaseReqH(nixlBackendReqH* handle) const override;
 
         int progress() override;
 
+        uint64_t getProgressWakeups() const {
+            return pthrWakeups.load(std::memory_order_relaxed);
+        }
+
         nixl_status_t getNotifs(notif_list_t &notif_list);
         nixl_status_t genNotif(const std::string &remote_agent, const std::string &msg) const override;
 
@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "ucx_cost_model.h"
+
+#include <algorithm>
+#include <cmath>
+
+void nixlUcxCostModel::costStats::add(double n, double b, double t, double decay)
+{
+    w  = w  * decay + 1;
+    nn = nn * decay + n * n;
+    nb = nb * decay + n * b;
+    bb = bb * decay + b * b;
+    nt = nt * decay + n * t;
+    bt = bt * decay + b * t;
+    tt = tt * decay + t * t;
+}
+
+void nixlUcxCostModel::costStats::fit(double &lat, double &inv_bw) const
+{
+    const double det = nn * bb - nb * nb;
+
+    // Size per descriptor didn't vary enough to separate the two terms,
+    // attribute the whole duration to the per descriptor latency
+    if (det <= 1e-9 * nn * bb) {
+        lat    = nt / nn;
+        inv_bw = 0;
+        return;
+    }
+
+    lat    = (nt * bb - bt * nb) / det;
+    inv_bw = (bt * nn - nt * nb) / det;
+
+    // Noise can make one of the terms negative, refit with the other alone
+    if (lat < 0) {
+        lat    = 0;
+        inv_bw = bt / bb;
+    } else if (inv_bw < 0) {
+        lat    = nt / nn;
+        inv_bw = 0;
+    }
+}
+
+double nixlUcxCostModel::costStats::rms(double lat, double inv_bw) const
+{
+    double ss = tt - 2 * (lat * nt + inv_bw * bt) +
+                lat * lat * nn + 2 * lat * inv_bw * nb + inv_bw * inv_bw * bb;
+
+    return std::sqrt(std::max(ss, 0.0) / w);
+}
+
+size_t nixlUcxCostModel::sizeClass(size_t bytes)
+{
+    size_t cls = 0;
+
+    while ((bytes >>= 1) && (cls < numSizeClasses - 1))
+        cls++;
+
+    return cls;
+}
+
+void nixlUcxCostModel::record(const std::string &remote_agent, size_t bytes, size_t descs,
+                              std::chrono::microseconds duration)
+{
+    if (descs == 0)
+        return;
+
+    const double t = duration.count();
+    std::lock_guard<std::mutex> guard(lock);
+    auto &peer = peers[remote_agent];
+
+    peer.all.add(descs, bytes, t, decay);
+    peer.classes[sizeClass(bytes)].add(descs, bytes, t, decay);
+}
+
+bool nixlUcxCostModel::estimate(const std::string &remote_agent, size_t bytes, size_t descs,
+                                std::chrono::microseconds &duration,
+                                std::chrono::microseconds &err_margin) const
+{
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = peers.find(remote_agent);
+
+    if (it == peers.end())
+        return false;
+
+    // Prefer the size class as queueing and protocol switches depend on size,
+    // fall back to all the transfers to this peer until it has enough samples
+    const costStats *stats = &it->second.classes[sizeClass(bytes)];
+    if (stats->w < minWeight) {
+        stats = &it->second.all;
+        if (stats->w < minWeight)
+            return false;
+    }
+
+    double lat, inv_bw;
+    stats->fit(lat, inv_bw);
+
+    duration   = std::chrono::microseconds(std::llround(descs * lat + bytes * inv_bw));
+    err_margin = std::chrono::microseconds(std::llround(stats->rms(lat, inv_bw)));
+    return true;
+}
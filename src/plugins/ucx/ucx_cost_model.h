@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef NIXL_SRC_PLUGINS_UCX_UCX_COST_MODEL_H
+#define NIXL_SRC_PLUGINS_UCX_UCX_COST_MODEL_H
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "common/str_tools.h"
+
+// Transfer cost learned from completed transfers, per remote agent and size class.
+// Samples are fitted to duration = descs * latency + bytes / bandwidth, older
+// samples decay exponentially so the model follows changes in congestion.
+class nixlUcxCostModel {
+    private:
+        // Exponentially decayed sums for weighted least squares, n is the
+        // descriptor count, b the size in bytes and t the duration in us
+        struct costStats {
+            double w  = 0;
+            double nn = 0, nb = 0, bb = 0;
+            double nt = 0, bt = 0, tt = 0;
+
+            void add(double n, double b, double t, double decay);
+            void fit(double &lat, double &inv_bw) const;
+            double rms(double lat, double inv_bw) const;
+        };
+
+        // Size classes are powers of two of the total transfer size
+        static constexpr size_t numSizeClasses = 64;
+        // Minimal decayed weight (~number of samples) to trust a fit
+        static constexpr double minWeight = 4.0;
+
+        struct peerStats {
+            costStats all;
+            std::array<costStats, numSizeClasses> classes;
+        };
+
+        const double decay;
+        mutable std::mutex lock;
+        std::unordered_map<std::string, peerStats,
+                           std::hash<std::string>, strEqual> peers;
+
+        static size_t sizeClass(size_t bytes);
+
+    public:
+        explicit nixlUcxCostModel(double decay_) : decay(decay_) {}
+
+        void record(const std::string &remote_agent, size_t bytes, size_t descs,
+                    std::chrono::microseconds duration);
+
+        // Returns false if not enough transfers were observed for this peer
+        bool estimate(const std::string &remote_agent, size_t bytes, size_t descs,
+                      std::chrono::microseconds &duration,
+                      std::chrono::microseconds &err_margin) const;
+};
+
+#endif
@@ -15,12 +15,16 @@
  * limitations under the License.
  */
 #include <stdlib.h>
+#include <unistd.h>
+#include <sys/syscall.h>
 #include <cassert>
+#include <fstream>
 
 
 // Local includes
 #include <nixl.h>
 #include <common/nixl_time.h>
+#include <common/nixl_log.h>
 #include <serdes/serdes.h>
 #include <ucx_mo_backend.h>
 
@@ -55,6 +59,119 @@ static uint32_t _getNumVramDevices(){
 
 #endif
 
+/****************************************
+ * NUMA related code
+*****************************************/
+
+// Number of NUMA nodes in the system, 1 if it can't be determined
+static uint32_t _getNumNumaNodes()
+{
+    // The list is in "0-1" or "0,2-3" format, the last number is the highest node
+    std::ifstream f("/sys/devices/system/node/online");
+    std::string online;
+
+    if (!(f >> online)) {
+        return 1;
+    }
+
+    size_t pos = online.find_last_of(",-");
+    std::string last = (pos == std::string::npos) ? online : online.substr(pos + 1);
+    char *eptr;
+    unsigned long node = strtoul(last.c_str(), &eptr, 10);
+    if (eptr == last.c_str()) {
+        return 1;
+    }
+    return node + 1;
+}
+
+// NUMA node the page at addr resides on, -1 if unknown. The page is only
+// queried, not faulted in, so memory that was never touched is unknown.
+static int _getMemNumaNode(uintptr_t addr)
+{
+#ifdef SYS_move_pages
+    void *page = (void*)(addr & ~((uintptr_t)sysconf(_SC_PAGESIZE) - 1));
+    int status = -1;
+
+    if (syscall(SYS_move_pages, 0, 1UL, &page, nullptr, &status, 0) < 0) {
+        return -1;
+    }
+    return (status >= 0) ? status : -1;
+#else
+    return -1;
+#endif
+}
+
+/****************************************
+ * Parallel post pool
+*****************************************/
+
+nixlUcxMoPostPool::nixlUcxMoPostPool(size_t num_threads) : stop(false)
+{
+    for (size_t i = 0; i < num_threads; i++) {
+        threads.emplace_back(&nixlUcxMoPostPool::workerFunc, this);
+    }
+}
+
+nixlUcxMoPostPool::~nixlUcxMoPostPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stop = true;
+    }
+    cv.notify_all();
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+void nixlUcxMoPostPool::workerFunc()
+{
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            cv.wait(guard, [this] { return stop || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void nixlUcxMoPostPool::run(const std::vector<std::function<void()>> &jobs)
+{
+    std::mutex done_lock;
+    std::condition_variable done_cv;
+    size_t pending;
+
+    if (jobs.empty()) {
+        return;
+    }
+    pending = jobs.size() - 1;
+
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        for (size_t i = 1; i < jobs.size(); i++) {
+            tasks.emplace_back([&jobs, i, &done_lock, &done_cv, &pending] {
+                jobs[i]();
+                std::lock_guard<std::mutex> done_guard(done_lock);
+                if (--pending == 0) {
+                    done_cv.notify_one();
+                }
+            });
+        }
+    }
+    cv.notify_all();
+
+    jobs[0]();
+
+    std::unique_lock<std::mutex> done_guard(done_lock);
+    done_cv.wait(done_guard, [&pending] { return pending == 0; });
+}
+
 /****************************************
  * UCX/MO Request management
 *****************************************/
@@ -147,6 +264,30 @@ nixlUcxMoEngine::getEngIdx(nixl_mem_t type, uint64_t devId)
     return (devId < _engineCnt) ? devId : -1;
 }
 
+int32_t
+nixlUcxMoEngine::getEngIdx(nixl_mem_t type, uint64_t devId, uintptr_t addr)
+{
+    int node;
+
+    if ((type != DRAM_SEG) || !numaAware || (_numaCnt < 2)) {
+        return getEngIdx(type, devId);
+    }
+
+    node = _getMemNumaNode(addr);
+    if ((node < 0) || ((uint32_t)node >= _numaCnt)) {
+        return getEngIdx(type, devId);
+    }
+
+    if (_engineCnt < _numaCnt) {
+        return node % _engineCnt;
+    }
+
+    // Engines node, node + _numaCnt, ... serve this node, devId selects
+    // among them so the user can still spread the load
+    uint32_t node_engines = (_engineCnt - node + _numaCnt - 1) / _numaCnt;
+    return node + _numaCnt * (devId % node_engines);
+}
+
 string
 nixlUcxMoEngine::getEngName(const string &baseName, uint32_t eidx) const
 {
@@ -173,6 +314,7 @@ nixlUcxMoEngine::nixlUcxMoEngine(const nixlBackendInitParams* init_params):
 {
     nixl_b_params_t* custom_params = init_params->customParams;
     uint32_t num_ucx_engines = 1;
+    uint32_t num_post_threads = 0;
     if (custom_params->count("num_ucx_engines")) {
         const char *cptr = (*custom_params)["num_ucx_engines"].c_str();
         char *eptr;
@@ -186,6 +328,23 @@ nixlUcxMoEngine::nixlUcxMoEngine(const nixlBackendInitParams* init_params):
         }
     }
 
+    if (custom_params->count("num_post_threads")) {
+        const std::string &val = (*custom_params)["num_post_threads"];
+        char *eptr;
+        uint32_t tmp = strtoul(val.c_str(), &eptr, 0);
+        if ((size_t)(eptr - val.c_str()) == val.length()) {
+            num_post_threads = tmp;
+        } else {
+            this->initErr = true;
+            NIXL_ERROR << "Invalid num_post_threads value: " << val;
+            return;
+        }
+    }
+
+    numaAware = custom_params->count("numa_aware") &&
+                ((*custom_params)["numa_aware"] == "true");
+    _numaCnt = numaAware ? _getNumNumaNodes() : 1;
+
     setEngCnt(num_ucx_engines);
     // Initialize required number of engines
     for (uint32_t i = 0; i < getEngCnt(); i++) {
@@ -197,6 +356,10 @@ nixlUcxMoEngine::nixlUcxMoEngine(const nixlBackendInitParams* init_params):
         }
         engines.push_back(std::move(e));
     }
+
+    if (num_post_threads > 0) {
+        postPool = std::make_unique<nixlUcxMoPostPool>(num_post_threads);
+    }
 }
 
 nixl_mem_list_t
@@ -344,7 +507,7 @@ nixlUcxMoEngine::registerMem (const nixlBlobDesc &mem,
                               nixlBackendMD* &out)
 {
     auto priv = std::make_unique<nixlUcxMoPrivateMetadata>();
-    int32_t eidx = getEngIdx(nixl_mem, mem.devId);
+    int32_t eidx = getEngIdx(nixl_mem, mem.devId, mem.addr);
     nixlSerDes sd;
     string str;
     nixl_status_t status;
@@ -622,9 +785,13 @@ nixlUcxMoEngine::postXfer (const nixl_xfer_op_t &operation,
                            const nixl_opt_b_args_t *opt_args) const
 {
     nixlUcxMoRequestH *req = (nixlUcxMoRequestH *)handle;
+    std::vector<nixl_status_t> row_ret(req->dlMatrix.size(), NIXL_SUCCESS);
+    std::vector<std::function<void()>> jobs;
     bool in_progress = false;
 
-    for(size_t lidx = 0; lidx < req->dlMatrix.size(); lidx++) {
+    // Each row belongs to one local engine, posts to different engines
+    // don't share any state and can be issued concurrently
+    auto post_row = [&](size_t lidx) {
         for(size_t ridx = 0; ridx < req->dlMatrix[lidx].size(); ridx++) {
             nixl_status_t ret;
 
@@ -643,15 +810,40 @@ nixlUcxMoEngine::postXfer (const nixl_xfer_op_t &operation,
             switch(ret) {
             case NIXL_IN_PROG:
                 req->dlMatrix[lidx][ridx].in_progress = true;
-                in_progress = true;
+                row_ret[lidx] = NIXL_IN_PROG;
             case NIXL_SUCCESS:
                 // Nothing to do
                 break;
             default:
                 // Error.
-                return ret;
+                row_ret[lidx] = ret;
+                return;
             }
         }
+    };
+
+    for(size_t lidx = 0; lidx < req->dlMatrix.size(); lidx++) {
+        for(size_t ridx = 0; ridx < req->dlMatrix[lidx].size(); ridx++) {
+            if (req->dlMatrix[lidx][ridx].in_use) {
+                jobs.emplace_back([&post_row, lidx] { post_row(lidx); });
+                break;
+            }
+        }
+    }
+
+    if (postPool && (jobs.size() > 1)) {
+        postPool->run(jobs);
+    } else {
+        for (auto &job : jobs) {
+            job();
+        }
+    }
+
+    for (auto ret : row_ret) {
+        if (ret < 0) {
+            return ret;
+        }
+        in_progress |= (ret == NIXL_IN_PROG);
     }
 
     if (in_progress) {
@@ -22,6 +22,9 @@
 #include <iostream>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <cassert>
 #include <memory>
 
@@ -84,13 +87,36 @@ public:
 
 
 
+// Small pool of threads used to post to several UCX engines concurrently
+class nixlUcxMoPostPool {
+private:
+    std::vector<std::thread> threads;
+    std::mutex lock;
+    std::condition_variable cv;
+    std::deque<std::function<void()>> tasks;
+    bool stop;
+
+    void workerFunc();
+
+public:
+    nixlUcxMoPostPool(size_t num_threads);
+    ~nixlUcxMoPostPool();
+
+    // Runs all jobs and returns when they're done, the first one is
+    // executed on the calling thread
+    void run(const std::vector<std::function<void()>> &jobs);
+};
+
 class nixlUcxMoEngine : public nixlBackendEngine {
 private:
     uint32_t _engineCnt;
     uint32_t _gpuCnt;
+    uint32_t _numaCnt;
+    bool numaAware;
     int setEngCnt(uint32_t host_engines);
     uint32_t getEngCnt();
     int32_t getEngIdx(nixl_mem_t type, uint64_t devId);
+    int32_t getEngIdx(nixl_mem_t type, uint64_t devId, uintptr_t addr);
     std::string getEngName(const std::string &baseName, uint32_t eidx) const;
     std::string getEngBase(const std::string &engName);
     bool pthrOn;
@@ -101,6 +127,9 @@ private:
     using remote_conn_map_t = std::map<std::string, nixlUcxMoConnection>;
     using remote_comm_it_t = remote_conn_map_t::iterator;
     remote_conn_map_t remoteConnMap;
+    // Posts to different engines in parallel if set, must be destroyed
+    // before the engines
+    std::unique_ptr<nixlUcxMoPostPool> postPool;
 
     // Memory helper
     nixl_status_t internalMDHelper (const nixl_blob_t &blob,
@@ -276,6 +276,30 @@ nixl_status_t nixlUcxEp::write(void *laddr, nixlUcxMem &mem,
     return ucx_status_to_nixl(UCS_PTR_STATUS(request));
 }
 
+nixl_status_t nixlUcxEp::atomicAdd(uint64_t value, uint64_t raddr,
+                                   nixlUcxRkey &rk, nixlUcxReq &req)
+{
+    nixl_status_t status = checkTxState();
+    if (status != NIXL_SUCCESS) {
+        return status;
+    }
+
+    // Operand is copied by UCX, no need to keep it alive
+    ucp_request_param_t param = {
+        .op_attr_mask = UCP_OP_ATTR_FIELD_DATATYPE,
+        .datatype     = ucp_dt_make_contig(sizeof(value)),
+    };
+
+    ucs_status_ptr_t request = ucp_atomic_op_nbx(eph, UCP_ATOMIC_OP_ADD, &value, 1,
+                                                 raddr, rk.rkeyh, &param);
+    if (UCS_PTR_IS_PTR(request)) {
+        req = (void*)request;
+        return NIXL_IN_PROG;
+    }
+
+    return ucx_status_to_nixl(UCS_PTR_STATUS(request));
+}
+
 nixl_status_t nixlUcxEp::estimateCost(size_t size,
                                       std::chrono::microseconds &duration,
                                       std::chrono::microseconds &err_margin,
@@ -601,6 +625,11 @@ nixl_status_t nixlUcxWorker::test(nixlUcxReq req)
     return ucx_status_to_nixl(ucp_request_check_status(req));
 }
 
+nixl_status_t nixlUcxWorker::fence()
+{
+    return ucx_status_to_nixl(ucp_worker_fence(worker.get()));
+}
+
 void nixlUcxWorker::reqRelease(nixlUcxReq req)
 {
     ucp_request_free((void*)req);
@@ -114,6 +114,8 @@ public:
     nixl_status_t write(void *laddr, nixlUcxMem &mem,
                         uint64_t raddr, nixlUcxRkey &rk,
                         size_t size, nixlUcxReq &req);
+    nixl_status_t atomicAdd(uint64_t value, uint64_t raddr, nixlUcxRkey &rk,
+                            nixlUcxReq &req);
     nixl_status_t estimateCost(size_t size,
                                std::chrono::microseconds &duration,
                                std::chrono::microseconds &err_margin,
@@ -193,6 +195,7 @@ private:
     /* Data access */
     int progress();
     [[nodiscard]] nixl_status_t test(nixlUcxReq req);
+    nixl_status_t fence();
 
     void reqRelease(nixlUcxReq req);
     void reqCancel(nixlUcxReq req);
@@ -205,7 +208,10 @@ private:
     return {
         { "ucx_devices", "" },
         { "ucx_error_handling_mode", "none" }, // or "peer"
-        { "num_workers", "1" }
+        { "num_workers", "1" },
+        { "ucx_pt_busy_poll_us", "0" },
+        { "ucx_pt_cpu", "-1" },
+        { "ucx_cost_calibration", "false" } // or "true"
     };
 }
 
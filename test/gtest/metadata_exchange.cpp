@@ -71,7 +71,7 @@ private:
 };
 
 class MetadataExchangeTestFixture : public testing::Test {
-
+protected:
     struct AgentContext {
         static constexpr size_t BUFF_COUNT_ = 5;
         static constexpr size_t BUFF_SIZE_ = 1024;
@@ -312,6 +312,82 @@ TEST_F(MetadataExchangeTestFixture, GetLocalPartialWithErrors)
     ASSERT_NE(dst.agent->loadRemoteMD(md, remote_name), NIXL_SUCCESS);
 }
 
+TEST_F(MetadataExchangeTestFixture, CoalescedRegistration)
+{
+    constexpr size_t page_count = 16;
+    constexpr size_t page_size = 4096;
+
+    auto &plain = agents_[0];
+    auto &dst = agents_[1];
+    MemBuffer buffer(page_count * page_size);
+
+    nixlAgentConfig cfg(false, false, 0, nixl_thread_sync_t::NIXL_THREAD_SYNC_STRICT);
+    cfg.regCoalesce = true;
+    AgentContext coalesced(std::make_unique<nixlAgent>("agent_coalesced", cfg),
+                           "agent_coalesced", 0);
+
+    plain.createAgentBackend();
+    dst.createAgentBackend();
+    coalesced.createAgentBackend();
+
+    // Adjacent pages of a single buffer, registered separately
+    nixl_reg_dlist_t pages(DRAM_SEG);
+    for (size_t i = 0; i < page_count; i++) {
+        pages.addDesc(nixlBlobDesc(buffer + i * page_size, page_size, 0, ""));
+    }
+
+    ASSERT_EQ(plain.agent->registerMem(pages), NIXL_SUCCESS);
+    ASSERT_EQ(coalesced.agent->registerMem(pages), NIXL_SUCCESS);
+
+    std::string remote_name;
+    nixl_blob_t plain_md, md;
+
+    // The pages share a single registration, so its metadata is smaller
+    ASSERT_EQ(plain.agent->getLocalMD(plain_md), NIXL_SUCCESS);
+    ASSERT_EQ(coalesced.agent->getLocalMD(md), NIXL_SUCCESS);
+    EXPECT_LT(md.size(), plain_md.size());
+
+    ASSERT_EQ(dst.agent->loadRemoteMD(md, remote_name), NIXL_SUCCESS);
+    ASSERT_EQ(remote_name, coalesced.name);
+    ASSERT_EQ(dst.agent->checkRemoteMD(coalesced.name, pages.trim()), NIXL_SUCCESS);
+
+    // Deregistered pages are not valid anymore, the others still are
+    nixl_reg_dlist_t first_page(DRAM_SEG);
+    first_page.addDesc(pages[0]);
+    nixl_reg_dlist_t other_pages(DRAM_SEG);
+    for (size_t i = 1; i < page_count; i++) {
+        other_pages.addDesc(pages[i]);
+    }
+
+    ASSERT_EQ(coalesced.agent->deregisterMem(first_page), NIXL_SUCCESS);
+    ASSERT_NE(coalesced.agent->deregisterMem(first_page), NIXL_SUCCESS);
+    ASSERT_NE(coalesced.agent->getLocalPartialMD(first_page, md, nullptr), NIXL_SUCCESS);
+    ASSERT_EQ(coalesced.agent->getLocalPartialMD(other_pages, md, nullptr), NIXL_SUCCESS);
+
+    // The shared registration no longer covers the deregistered page for transfers
+    nixlXferReqH *req = nullptr;
+    nixl_xfer_dlist_t second_page(DRAM_SEG);
+    second_page.addDesc(pages[1]);
+    EXPECT_NE(coalesced.agent->createXferReq(
+                  NIXL_WRITE, first_page.trim(), second_page, coalesced.name, req),
+              NIXL_SUCCESS);
+    nixl_xfer_dlist_t third_page(DRAM_SEG);
+    third_page.addDesc(pages[2]);
+    ASSERT_EQ(coalesced.agent->createXferReq(
+                  NIXL_WRITE, third_page, second_page, coalesced.name, req),
+              NIXL_SUCCESS);
+    EXPECT_EQ(coalesced.agent->releaseXferReq(req), NIXL_SUCCESS);
+
+    // Nor in the metadata exported after the deregistration
+    ASSERT_EQ(coalesced.agent->getLocalMD(md), NIXL_SUCCESS);
+    ASSERT_EQ(plain.agent->loadRemoteMD(md, remote_name), NIXL_SUCCESS);
+    EXPECT_NE(plain.agent->checkRemoteMD(coalesced.name, first_page.trim()), NIXL_SUCCESS);
+    EXPECT_EQ(plain.agent->checkRemoteMD(coalesced.name, other_pages.trim()), NIXL_SUCCESS);
+
+    ASSERT_EQ(coalesced.agent->deregisterMem(other_pages), NIXL_SUCCESS);
+    ASSERT_NE(coalesced.agent->deregisterMem(other_pages), NIXL_SUCCESS);
+}
+
 TEST_F(MetadataExchangeTestFixture, SocketSendLocalAndInvalidateLocal)
 {
     initAgentsDefault();
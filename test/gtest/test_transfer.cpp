@@ -24,6 +24,7 @@
 #include <absl/strings/str_format.h>
 #include <absl/time/clock.h>
 #include <gtest/gtest.h>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <thread>
@@ -398,6 +399,71 @@ protected:
         invalidateMD();
     }
 
+    void doBatchTransfer(nixlAgent &from, const std::string &from_name,
+                         nixlAgent &to, const std::string &to_name, size_t num_reqs,
+                         const std::vector<MemBuffer> &src_buffers,
+                         const std::vector<MemBuffer> &dst_buffers)
+    {
+        const size_t count = src_buffers.size() / num_reqs;
+
+        for (size_t i = 0; i < src_buffers.size(); i++) {
+            memset((void*)(uintptr_t)src_buffers[i], 'a' + (i % 26), src_buffers[i].getSize());
+            memset((void*)(uintptr_t)dst_buffers[i], 0, dst_buffers[i].getSize());
+        }
+
+        nixl_opt_args_t extra_params;
+        extra_params.hasNotif = true;
+        extra_params.notifMsg = NOTIF_MSG;
+
+        std::vector<nixlXferReqH*> xfer_reqs;
+        for (size_t r = 0; r < num_reqs; r++) {
+            std::vector<MemBuffer> src(src_buffers.begin() + r * count,
+                                       src_buffers.begin() + (r + 1) * count);
+            std::vector<MemBuffer> dst(dst_buffers.begin() + r * count,
+                                       dst_buffers.begin() + (r + 1) * count);
+
+            nixlXferReqH *xfer_req = nullptr;
+            nixl_status_t status = from.createXferReq(
+                    NIXL_WRITE, makeDescList<nixlBasicDesc>(src, DRAM_SEG),
+                    makeDescList<nixlBasicDesc>(dst, DRAM_SEG), to_name,
+                    xfer_req, &extra_params);
+            ASSERT_EQ(status, NIXL_SUCCESS);
+            xfer_reqs.push_back(xfer_req);
+        }
+
+        // Post twice to also cover reposting a completed group
+        for (int repeat = 0; repeat < 2; repeat++) {
+            nixl_status_t status = from.postXferReqs(xfer_reqs);
+            ASSERT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+
+            for (auto xfer_req : xfer_reqs) {
+                for (int i = 0; i < retry_count; i++) {
+                    status = from.getXferStatus(xfer_req);
+                    EXPECT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+                    if (status == NIXL_SUCCESS) {
+                        break;
+                    }
+                    std::this_thread::sleep_for(retry_timeout);
+                }
+                EXPECT_EQ(status, NIXL_SUCCESS);
+            }
+        }
+
+        verifyNotifs(to, from_name, 2 * num_reqs);
+
+        for (size_t i = 0; i < src_buffers.size(); i++) {
+            EXPECT_EQ(memcmp((void*)(uintptr_t)src_buffers[i],
+                             (void*)(uintptr_t)dst_buffers[i],
+                             src_buffers[i].getSize()), 0);
+        }
+
+        for (auto xfer_req : xfer_reqs) {
+            EXPECT_EQ(from.releaseXferReq(xfer_req), NIXL_SUCCESS);
+        }
+
+        invalidateMD();
+    }
+
     nixlAgent &getAgent(size_t idx)
     {
         return *agents[idx];
@@ -462,6 +528,123 @@ TEST_P(TestTransfer, remoteMDFromSocket)
                mem_type, dst_buffers);
 }
 
+TEST_P(TestTransfer, BatchPost)
+{
+    constexpr size_t size = 16384;
+    constexpr size_t count = 16;
+    constexpr size_t num_reqs = 8;
+    std::vector<MemBuffer> src_buffers, dst_buffers;
+
+    createRegisteredMem(getAgent(0), size, count * num_reqs, DRAM_SEG, src_buffers);
+    createRegisteredMem(getAgent(1), size, count * num_reqs, DRAM_SEG, dst_buffers);
+
+    exchangeMD();
+    doBatchTransfer(getAgent(0), getAgentName(0), getAgent(1), getAgentName(1),
+                    num_reqs, src_buffers, dst_buffers);
+}
+
+TEST_P(TestTransfer, BatchPostRejectsRepost)
+{
+    constexpr size_t size = 16 * 1024 * 1024;
+    constexpr size_t num_reqs = 2;
+    std::vector<MemBuffer> src_buffers, dst_buffers;
+
+    createRegisteredMem(getAgent(0), size, num_reqs, DRAM_SEG, src_buffers);
+    createRegisteredMem(getAgent(1), size, num_reqs, DRAM_SEG, dst_buffers);
+
+    exchangeMD();
+
+    std::vector<nixlXferReqH*> xfer_reqs;
+    for (size_t r = 0; r < num_reqs; r++) {
+        nixlXferReqH *xfer_req = nullptr;
+        nixl_status_t status = getAgent(0).createXferReq(
+                NIXL_WRITE, makeDescList<nixlBasicDesc>({src_buffers[r]}, DRAM_SEG),
+                makeDescList<nixlBasicDesc>({dst_buffers[r]}, DRAM_SEG), getAgentName(1),
+                xfer_req);
+        ASSERT_EQ(status, NIXL_SUCCESS);
+        xfer_reqs.push_back(xfer_req);
+    }
+
+    // A request listed twice fails the whole group before anything is posted
+    EXPECT_EQ(getAgent(0).postXferReqs({xfer_reqs[0], xfer_reqs[1], xfer_reqs[0]}),
+              NIXL_ERR_INVALID_PARAM);
+    for (auto xfer_req : xfer_reqs) {
+        EXPECT_EQ(getAgent(0).getXferStatus(xfer_req), NIXL_ERR_NOT_POSTED);
+    }
+
+    // So does a request still in progress
+    nixl_status_t status = getAgent(0).postXferReqs({xfer_reqs[0]});
+    ASSERT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+    status = getAgent(0).postXferReqs({xfer_reqs[1], xfer_reqs[0]});
+    if (status == NIXL_ERR_INVALID_PARAM) {
+        EXPECT_EQ(getAgent(0).getXferStatus(xfer_reqs[1]), NIXL_ERR_NOT_POSTED);
+    } else {
+        // The first request completed before the group was checked
+        EXPECT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+    }
+
+    for (auto xfer_req : xfer_reqs) {
+        do {
+            status = getAgent(0).getXferStatus(xfer_req);
+        } while (status == NIXL_IN_PROG);
+        EXPECT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_ERR_NOT_POSTED));
+        EXPECT_EQ(getAgent(0).releaseXferReq(xfer_req), NIXL_SUCCESS);
+    }
+
+    invalidateMD();
+}
+
+TEST_P(TestTransfer, RemoteCounter)
+{
+    // UCX_MO does not support remote counters
+    if (getBackendName() == "UCX_MO") {
+        GTEST_SKIP() << "UCX_MO does not support remote counters";
+    }
+
+    constexpr size_t size = 4096;
+    constexpr size_t count = 4;
+    constexpr size_t repeat = 10;
+    std::vector<MemBuffer> src_buffers, dst_buffers, counter_buffers;
+
+    createRegisteredMem(getAgent(0), size, count, DRAM_SEG, src_buffers);
+    createRegisteredMem(getAgent(1), size, count, DRAM_SEG, dst_buffers);
+    createRegisteredMem(getAgent(1), sizeof(uint64_t), 1, DRAM_SEG, counter_buffers);
+
+    volatile uint64_t *counter = (uint64_t*)(uintptr_t)counter_buffers.front();
+    *counter = 0;
+
+    exchangeMD();
+
+    nixl_opt_args_t extra_params;
+    extra_params.hasRemoteCounter  = true;
+    extra_params.remoteCounterAddr = counter_buffers.front();
+    extra_params.remoteCounterMem  = DRAM_SEG;
+
+    nixlXferReqH *xfer_req = nullptr;
+    nixl_status_t status = getAgent(0).createXferReq(
+            NIXL_WRITE, makeDescList<nixlBasicDesc>(src_buffers, DRAM_SEG),
+            makeDescList<nixlBasicDesc>(dst_buffers, DRAM_SEG), getAgentName(1),
+            xfer_req, &extra_params);
+    ASSERT_EQ(status, NIXL_SUCCESS);
+
+    for (size_t i = 1; i <= repeat; i++) {
+        status = getAgent(0).postXferReq(xfer_req);
+        ASSERT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+
+        do {
+            status = getAgent(0).getXferStatus(xfer_req);
+            ASSERT_TRUE((status == NIXL_SUCCESS) || (status == NIXL_IN_PROG));
+        } while (status == NIXL_IN_PROG);
+
+        // Increment is ordered after the data and flushed with it
+        EXPECT_EQ(*counter, i);
+    }
+
+    EXPECT_EQ(getAgent(0).releaseXferReq(xfer_req), NIXL_SUCCESS);
+
+    invalidateMD();
+}
+
 TEST_P(TestTransfer, NotificationOnly) {
     constexpr size_t repeat = 100;
     constexpr size_t num_threads = 4;
@@ -0,0 +1,212 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hf3fs_backend.h"
+#include "hf3fs_reaper.h"
+
+namespace gtest::hf3fs {
+
+// Completes the IOs the tests push instead of waiting on a 3FS mount
+class StubHf3fsUtil : public hf3fsUtil {
+private:
+    std::mutex lock_;
+    std::map<const hf3fs_ior *, std::deque<hf3fs_cqe>> completions_;
+    std::map<const hf3fs_ior *, size_t> polls_;
+
+public:
+    void
+    complete (nixlHf3fsBackendReqH &handle, nixlHf3fsIO *io, int64_t result = 0) {
+        std::lock_guard<std::mutex> guard (lock_);
+        hf3fs_cqe cqe = {};
+        cqe.result = result;
+        cqe.userdata = io;
+        completions_[&handle.ior].push_back (cqe);
+    }
+
+    size_t
+    polls (const nixlHf3fsBackendReqH &handle) {
+        std::lock_guard<std::mutex> guard (lock_);
+        return polls_[&handle.ior];
+    }
+
+    nixl_status_t
+    waitForIOs (struct hf3fs_ior *ior,
+                struct hf3fs_cqe *cqes,
+                int num_cqes,
+                int min_cqes,
+                struct timespec *ts,
+                int *num_completed) override {
+        std::lock_guard<std::mutex> guard (lock_);
+        auto &queue = completions_[ior];
+        int count = 0;
+
+        polls_[ior]++;
+        while (count < num_cqes && !queue.empty()) {
+            cqes[count++] = queue.front();
+            queue.pop_front();
+        }
+
+        *num_completed = count;
+        return NIXL_SUCCESS;
+    }
+};
+
+class Hf3fsReaperTest : public testing::Test {
+protected:
+    StubHf3fsUtil utils_;
+
+    // Handle with its IOs, owned by the test instead of the engine
+    struct request {
+        nixlHf3fsBackendReqH handle;
+        std::vector<std::unique_ptr<nixlHf3fsIO>> ios;
+
+        nixlHf3fsIO *
+        addIO() {
+            ios.emplace_back (new nixlHf3fsIO());
+            handle.io_list.push_back (ios.back().get());
+            return ios.back().get();
+        }
+    };
+
+    void
+    post (nixlHf3fsReaper &reaper, request &req) {
+        req.handle.num_ios += req.ios.size();
+        reaper.add (&req.handle);
+    }
+
+    void
+    completeAll (request &req) {
+        for (auto &io : req.ios)
+            utils_.complete (req.handle, io.get());
+    }
+
+    bool
+    waitFor (const std::function<bool()> &done) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds (10);
+        while (!done()) {
+            if (std::chrono::steady_clock::now() > deadline) return false;
+            std::this_thread::sleep_for (std::chrono::milliseconds (1));
+        }
+        return true;
+    }
+};
+
+TEST_F (Hf3fsReaperTest, CompletesManyHandles) {
+    nixlHf3fsReaper reaper (&utils_, 2);
+    std::vector<std::unique_ptr<request>> reqs;
+
+    for (int i = 0; i < 200; i++) {
+        reqs.emplace_back (new request());
+        for (int j = 0; j < 4; j++)
+            reqs.back()->addIO();
+        post (reaper, *reqs.back());
+    }
+
+    for (auto &req : reqs)
+        completeAll (*req);
+
+    for (auto &req : reqs) {
+        ASSERT_TRUE (waitFor ([&req] { return req->handle.completed_ios == 4; }));
+        EXPECT_EQ (req->handle.error_status, NIXL_SUCCESS);
+    }
+
+    for (auto &req : reqs)
+        reaper.remove (&req->handle);
+}
+
+TEST_F (Hf3fsReaperTest, CopiesBounceReads) {
+    nixlHf3fsReaper reaper (&utils_, 1);
+    std::string bounce = "read through the bounce buffer";
+    std::string user (bounce.size(), '\0');
+    request req;
+
+    nixlHf3fsIO *io = req.addIO();
+    io->is_read = true;
+    io->bounce = true;
+    io->io_addr = bounce.data();
+    io->orig_addr = user.data();
+    io->size = bounce.size();
+
+    post (reaper, req);
+    completeAll (req);
+
+    ASSERT_TRUE (waitFor ([&req] { return req.handle.completed_ios == 1; }));
+    EXPECT_EQ (user, bounce);
+    reaper.remove (&req.handle);
+}
+
+TEST_F (Hf3fsReaperTest, ReportsIOError) {
+    nixlHf3fsReaper reaper (&utils_, 1);
+    request req;
+
+    nixlHf3fsIO *io = req.addIO();
+    req.addIO();
+    post (reaper, req);
+    utils_.complete (req.handle, io, -EIO);
+
+    ASSERT_TRUE (waitFor ([&req] { return req.handle.error_status != NIXL_SUCCESS; }));
+    EXPECT_EQ (req.handle.error_status, NIXL_ERR_BACKEND);
+    EXPECT_NE (req.handle.error_message.find (std::to_string (-EIO)), std::string::npos);
+    EXPECT_EQ (req.handle.completed_ios, 0u);
+    reaper.remove (&req.handle);
+}
+
+TEST_F (Hf3fsReaperTest, RepostReusesHandle) {
+    nixlHf3fsReaper reaper (&utils_, 1);
+    request req;
+
+    req.addIO();
+    req.addIO();
+
+    for (uint32_t round = 1; round <= 3; round++) {
+        post (reaper, req);
+        completeAll (req);
+        ASSERT_TRUE (waitFor ([&req, round] { return req.handle.completed_ios == 2 * round; }));
+    }
+
+    EXPECT_EQ (req.handle.num_ios, 6u);
+    EXPECT_EQ (req.handle.error_status, NIXL_SUCCESS);
+    reaper.remove (&req.handle);
+}
+
+TEST_F (Hf3fsReaperTest, RemovedHandleIsNotPolled) {
+    nixlHf3fsReaper reaper (&utils_, 1);
+    request req;
+
+    req.addIO();
+    post (reaper, req);
+    ASSERT_TRUE (waitFor ([this, &req] { return utils_.polls (req.handle) > 0; }));
+
+    reaper.remove (&req.handle);
+    size_t polls = utils_.polls (req.handle);
+    std::this_thread::sleep_for (std::chrono::milliseconds (20));
+    EXPECT_EQ (utils_.polls (req.handle), polls);
+}
+
+} // namespace gtest::hf3fs
@@ -20,18 +20,56 @@
 #include <string>
 #include <vector>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <deque>
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <future>
+#include <thread>
 
 #include "obj_s3_client.h"
 #include "obj_backend.h"
 #include "obj_executor.h"
+#include "obj_range_tuner.h"
+#include "obj_local_fs_client.h"
+#include <filesystem>
+#include <fstream>
+#include <cstdlib>
 
 namespace gtest::obj {
 
 class MockS3Client : public IS3Client {
 private:
     bool simulate_success_ = true;
+    int fail_part_number_ = 0;
     std::shared_ptr<AsioThreadPoolExecutor> executor_;
-    std::vector<std::function<void()>> pending_callbacks_;
+    std::mutex lock_;
+    std::deque<std::function<void()>> pending_callbacks_;
+
+    // Multipart uploads in progress, parts by part number, and completed objects
+    std::map<std::string, std::map<int, std::string>> uploads_;
+    std::map<std::string, std::string> objects_;
+    size_t next_upload_id_ = 0;
+    size_t aborted_uploads_ = 0;
+    size_t pending_parts_ = 0;
+    size_t max_pending_parts_ = 0;
+
+    void
+    pushCallback (std::function<void()> callback) {
+        std::lock_guard<std::mutex> guard (lock_);
+        pending_callbacks_.push_back (std::move (callback));
+    }
+
+    bool
+    popCallback (std::function<void()> &callback) {
+        std::lock_guard<std::mutex> guard (lock_);
+        if (pending_callbacks_.empty()) return false;
+        callback = std::move (pending_callbacks_.front());
+        pending_callbacks_.pop_front();
+        return true;
+    }
 
 public:
     void
@@ -39,6 +77,11 @@ public:
         simulate_success_ = success;
     }
 
+    void
+    setFailPartNumber (int part_number) {
+        fail_part_number_ = part_number;
+    }
+
     void
     setExecutor (std::shared_ptr<Aws::Utils::Threading::Executor> executor) override {
         executor_ = std::dynamic_pointer_cast<AsioThreadPoolExecutor> (executor);
@@ -50,7 +93,7 @@ public:
                     size_t data_len,
                     size_t offset,
                     PutObjectCallback callback) override {
-        pending_callbacks_.push_back ([callback, this]() { callback (simulate_success_); });
+        pushCallback ([callback, this]() { callback (simulate_success_); });
     }
 
     void
@@ -59,7 +102,7 @@ public:
                     size_t data_len,
                     size_t offset,
                     GetObjectCallback callback) override {
-        pending_callbacks_.push_back ([callback, data_ptr, data_len, offset, this]() {
+        pushCallback ([callback, data_ptr, data_len, offset, this]() {
             if (simulate_success_ && data_ptr && data_len > 0) {
                 char *buffer = reinterpret_cast<char *> (data_ptr);
                 for (size_t i = 0; i < data_len; ++i) {
@@ -71,16 +114,107 @@ public:
     }
 
     void
-    execAsync() {
-        for (auto &callback : pending_callbacks_) {
-            executor_->Submit ([callback]() { callback(); });
+    CreateMultipartUploadAsync (std::string_view key,
+                                CreateMultipartUploadCallback callback) override {
+        std::string upload_id = std::string (key) + "#" + std::to_string (next_upload_id_++);
+        pushCallback ([callback, upload_id, this]() {
+            if (simulate_success_) {
+                std::lock_guard<std::mutex> guard (lock_);
+                uploads_[upload_id];
+            }
+            callback (simulate_success_, upload_id);
+        });
+    }
+
+    void
+    UploadPartAsync (std::string_view key,
+                     std::string_view upload_id,
+                     int part_number,
+                     uintptr_t data_ptr,
+                     size_t data_len,
+                     UploadPartCallback callback) override {
+        {
+            std::lock_guard<std::mutex> guard (lock_);
+            max_pending_parts_ = std::max (max_pending_parts_, ++pending_parts_);
         }
-        pending_callbacks_.clear();
-        executor_->WaitUntilIdle();
+        pushCallback ([callback,
+                       id = std::string (upload_id),
+                       part_number,
+                       data_ptr,
+                       data_len,
+                       this]() {
+            bool success = simulate_success_ && part_number != fail_part_number_;
+            {
+                std::lock_guard<std::mutex> guard (lock_);
+                --pending_parts_;
+                if (success)
+                    uploads_[id][part_number] =
+                        std::string (reinterpret_cast<const char *> (data_ptr), data_len);
+            }
+            callback (success, "etag-" + std::to_string (part_number));
+        });
+    }
+
+    void
+    CompleteMultipartUploadAsync (std::string_view key,
+                                  std::string_view upload_id,
+                                  const std::vector<std::string> &etags,
+                                  CompleteMultipartUploadCallback callback) override {
+        pushCallback ([callback,
+                       key = std::string (key),
+                       id = std::string (upload_id),
+                       etags,
+                       this]() {
+            std::lock_guard<std::mutex> guard (lock_);
+            auto &parts = uploads_[id];
+            bool success = parts.size() == etags.size();
+            std::string object;
+            for (size_t i = 0; success && i < etags.size(); ++i) {
+                success = etags[i] == "etag-" + std::to_string (i + 1) && parts.count (i + 1);
+                if (success) object += parts[i + 1];
+            }
+            if (success) objects_[key] = object;
+            uploads_.erase (id);
+            callback (success);
+        });
+    }
+
+    void
+    AbortMultipartUploadAsync (std::string_view key,
+                               std::string_view upload_id,
+                               AbortMultipartUploadCallback callback) override {
+        pushCallback ([callback, id = std::string (upload_id), this]() {
+            {
+                std::lock_guard<std::mutex> guard (lock_);
+                uploads_.erase (id);
+                ++aborted_uploads_;
+            }
+            callback (true);
+        });
+    }
+
+    void
+    DeleteObjectAsync (std::string_view key, DeleteObjectCallback callback) override {
+        pushCallback ([callback, this]() { callback (simulate_success_); });
+    }
+
+    // Runs the pending callbacks, and the ones they issue, on the executor. Waits for
+    // them rather than for an idle pool, which would join its threads.
+    void
+    execAsync() {
+        std::promise<void> drained;
+        executor_->Submit ([this, &drained]() {
+            std::function<void()> callback;
+            while (popCallback (callback))
+                callback();
+            drained.set_value();
+        });
+        drained.get_future().wait();
     }
 
     size_t
-    getPendingCount() const {
+    getPendingCount() {
+        std::lock_guard<std::mutex> guard (lock_);
         return pending_callbacks_.size();
     }
 
@@ -88,6 +222,27 @@ public:
     hasExecutor() const {
         return executor_ != nullptr;
     }
+
+    const std::string *
+    getObject (const std::string &key) const {
+        auto it = objects_.find (key);
+        return it == objects_.end() ? nullptr : &it->second;
+    }
+
+    size_t
+    getOpenUploads() const {
+        return uploads_.size();
+    }
+
+    size_t
+    getAbortedUploads() const {
+        return aborted_uploads_;
+    }
+
+    size_t
+    getMaxPendingParts() const {
+        return max_pending_parts_;
+    }
 };
 
 class ObjTestFixture : public testing::Test {
@@ -113,6 +268,58 @@ protected:
         obj_engine_ = std::make_unique<nixlObjEngine> (&init_params_, mock_s3_client_);
     }
 
+    void
+    resetEngine() {
+        obj_engine_.reset();
+        obj_engine_ = std::make_unique<nixlObjEngine> (&init_params_, mock_s3_client_);
+    }
+
+    // Writes the buffer to one object with a descriptor per chunk, listed in reverse order
+    nixl_status_t
+    testMultipartWrite (const std::vector<char> &buffer,
+                        size_t chunk_size,
+                        const std::string &key,
+                        nixl_status_t &post_status) {
+        nixlBlobDesc local_desc, remote_desc;
+        local_desc.devId = 1;
+        remote_desc.devId = 2;
+        remote_desc.metaInfo = key;
+
+        nixlBackendMD *local_metadata = nullptr;
+        nixlBackendMD *remote_metadata = nullptr;
+        EXPECT_EQ (obj_engine_->registerMem (local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+        EXPECT_EQ (obj_engine_->registerMem (remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+        nixl_meta_dlist_t local_descs (DRAM_SEG);
+        nixl_meta_dlist_t remote_descs (OBJ_SEG);
+        for (size_t offset = buffer.size(); offset > 0;) {
+            size_t len = offset % chunk_size ? offset % chunk_size : chunk_size;
+            offset -= len;
+            local_descs.addDesc (nixlMetaDesc (
+                reinterpret_cast<uintptr_t> (buffer.data() + offset), len, local_desc.devId));
+            remote_descs.addDesc (nixlMetaDesc (offset, len, remote_desc.devId));
+        }
+
+        nixlBackendReqH *handle = nullptr;
+        EXPECT_EQ (
+            obj_engine_->prepXfer (
+                NIXL_WRITE, local_descs, remote_descs, init_params_.localAgent, handle, nullptr),
+            NIXL_SUCCESS);
+
+        nixl_status_t status = post_status = obj_engine_->postXfer (
+            NIXL_WRITE, local_descs, remote_descs, init_params_.localAgent, handle, nullptr);
+        if (post_status == NIXL_IN_PROG) {
+            EXPECT_EQ (obj_engine_->checkXfer (handle), NIXL_IN_PROG);
+            mock_s3_client_->execAsync();
+            status = obj_engine_->checkXfer (handle);
+        }
+
+        obj_engine_->releaseReqH (handle);
+        obj_engine_->deregisterMem (local_metadata);
+        obj_engine_->deregisterMem (remote_metadata);
+        return status;
+    }
+
     void
     testAsyncTransferWithControlledExecution (nixl_xfer_op_t operation) {
         mock_s3_client_->setSimulateSuccess (true);
@@ -487,4 +694,593 @@ TEST_F (ObjTestFixture, AsyncWriteTransferFailureIsHandled) {
     testAsyncTransferFailureIsHandled (NIXL_WRITE);
 }
 
+TEST_F (ObjTestFixture, MultipartWriteLargeDescriptor) {
+    const size_t part_size = 5 * 1024 * 1024;
+    custom_params_["multipart_part_size"] = std::to_string (part_size);
+    custom_params_["multipart_concurrency"] = "2";
+    resetEngine();
+
+    std::vector<char> buffer (2 * part_size + 12345);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char> (i * 7 % 251);
+
+    nixl_status_t post_status;
+    EXPECT_EQ (testMultipartWrite (buffer, buffer.size(), "test-multipart-key", post_status),
+               NIXL_SUCCESS);
+    EXPECT_EQ (post_status, NIXL_IN_PROG);
+
+    const std::string *object = mock_s3_client_->getObject ("test-multipart-key");
+    ASSERT_NE (object, nullptr);
+    EXPECT_TRUE (std::equal (buffer.begin(), buffer.end(), object->begin(), object->end()));
+    EXPECT_EQ (mock_s3_client_->getOpenUploads(), 0);
+    EXPECT_EQ (mock_s3_client_->getMaxPendingParts(), 2);
+}
+
+TEST_F (ObjTestFixture, MultipartWriteSharedKey) {
+    custom_params_["multipart_part_size"] = std::to_string (5 * 1024 * 1024);
+    resetEngine();
+
+    // Parts straddle the descriptors and are gathered
+    std::vector<char> buffer (4 * 3 * 1024 * 1024);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = static_cast<char> (i * 13 % 253);
+
+    nixl_status_t post_status;
+    EXPECT_EQ (testMultipartWrite (buffer, 3 * 1024 * 1024, "test-shared-key", post_status),
+               NIXL_SUCCESS);
+
+    const std::string *object = mock_s3_client_->getObject ("test-shared-key");
+    ASSERT_NE (object, nullptr);
+    EXPECT_TRUE (std::equal (buffer.begin(), buffer.end(), object->begin(), object->end()));
+}
+
+TEST_F (ObjTestFixture, MultipartWriteFailureAborts) {
+    custom_params_["multipart_part_size"] = std::to_string (5 * 1024 * 1024);
+    resetEngine();
+    mock_s3_client_->setFailPartNumber (2);
+
+    std::vector<char> buffer (12 * 1024 * 1024);
+    nixl_status_t post_status;
+    EXPECT_NE (testMultipartWrite (buffer, 1024 * 1024, "test-abort-key", post_status),
+               NIXL_SUCCESS);
+    EXPECT_EQ (mock_s3_client_->getObject ("test-abort-key"), nullptr);
+    EXPECT_EQ (mock_s3_client_->getAbortedUploads(), 1);
+    EXPECT_EQ (mock_s3_client_->getOpenUploads(), 0);
+}
+
+TEST_F (ObjTestFixture, MultipartWriteRejectsGaps) {
+    std::vector<char> buffer (1024);
+
+    nixlBlobDesc local_desc, remote_desc;
+    local_desc.devId = 1;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-gap-key";
+    nixlBackendMD *local_metadata = nullptr;
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ (obj_engine_->registerMem (local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+    ASSERT_EQ (obj_engine_->registerMem (remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs (DRAM_SEG);
+    nixl_meta_dlist_t remote_descs (OBJ_SEG);
+    local_descs.addDesc (
+        nixlMetaDesc (reinterpret_cast<uintptr_t> (buffer.data()), 256, local_desc.devId));
+    local_descs.addDesc (
+        nixlMetaDesc (reinterpret_cast<uintptr_t> (buffer.data() + 512), 256, local_desc.devId));
+    remote_descs.addDesc (nixlMetaDesc (0, 256, remote_desc.devId));
+    remote_descs.addDesc (nixlMetaDesc (512, 256, remote_desc.devId));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ (obj_engine_->prepXfer (
+                   NIXL_WRITE, local_descs, remote_descs, init_params_.localAgent, handle, nullptr),
+               NIXL_SUCCESS);
+    EXPECT_EQ (obj_engine_->postXfer (
+                   NIXL_WRITE, local_descs, remote_descs, init_params_.localAgent, handle, nullptr),
+               NIXL_ERR_INVALID_PARAM);
+    EXPECT_EQ (mock_s3_client_->getPendingCount(), 0);
+
+    obj_engine_->releaseReqH (handle);
+    obj_engine_->deregisterMem (local_metadata);
+    obj_engine_->deregisterMem (remote_metadata);
+}
+
+TEST_F (ObjTestFixture, RangedRead) {
+    custom_params_["read_chunk_size"] = std::to_string (1024 * 1024);
+    custom_params_["read_concurrency"] = "2";
+    resetEngine();
+    mock_s3_client_->setSimulateSuccess (true);
+
+    std::vector<char> test_buffer (5 * 1024 * 1024 + 512 * 1024);
+
+    nixlBlobDesc local_desc, remote_desc;
+    local_desc.devId = 1;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-ranged-key";
+    nixlBackendMD *local_metadata = nullptr;
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ (obj_engine_->registerMem (local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+    ASSERT_EQ (obj_engine_->registerMem (remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    const size_t offset = 300;
+    nixl_meta_dlist_t local_descs (DRAM_SEG);
+    nixl_meta_dlist_t remote_descs (OBJ_SEG);
+    local_descs.addDesc (nixlMetaDesc (
+        reinterpret_cast<uintptr_t> (test_buffer.data()), test_buffer.size(), local_desc.devId));
+    remote_descs.addDesc (nixlMetaDesc (offset, test_buffer.size(), remote_desc.devId));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ (obj_engine_->prepXfer (
+                   NIXL_READ, local_descs, remote_descs, init_params_.localAgent, handle, nullptr),
+               NIXL_SUCCESS);
+
+    nixl_status_t status = obj_engine_->postXfer (
+        NIXL_READ, local_descs, remote_descs, init_params_.localAgent, handle, nullptr);
+    EXPECT_EQ (status, NIXL_IN_PROG);
+    EXPECT_EQ (mock_s3_client_->getPendingCount(), 2);
+
+    mock_s3_client_->execAsync();
+    EXPECT_EQ (obj_engine_->checkXfer (handle), NIXL_SUCCESS);
+    for (size_t i = 0; i < test_buffer.size(); ++i)
+        ASSERT_EQ (test_buffer[i], static_cast<char> ('A' + ((i + offset) % 26))) << i;
+
+    obj_engine_->releaseReqH (handle);
+    obj_engine_->deregisterMem (local_metadata);
+    obj_engine_->deregisterMem (remote_metadata);
+}
+
+TEST_F (ObjTestFixture, RangedReadFailureIsHandled) {
+    custom_params_["read_chunk_size"] = std::to_string (1024 * 1024);
+    resetEngine();
+    mock_s3_client_->setSimulateSuccess (false);
+
+    std::vector<char> test_buffer (4 * 1024 * 1024);
+
+    nixlBlobDesc local_desc, remote_desc;
+    local_desc.devId = 1;
+    remote_desc.devId = 2;
+    remote_desc.metaInfo = "test-ranged-fail-key";
+    nixlBackendMD *local_metadata = nullptr;
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ (obj_engine_->registerMem (local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+    ASSERT_EQ (obj_engine_->registerMem (remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    nixl_meta_dlist_t local_descs (DRAM_SEG);
+    nixl_meta_dlist_t remote_descs (OBJ_SEG);
+    local_descs.addDesc (nixlMetaDesc (
+        reinterpret_cast<uintptr_t> (test_buffer.data()), test_buffer.size(), local_desc.devId));
+    remote_descs.addDesc (nixlMetaDesc (0, test_buffer.size(), remote_desc.devId));
+
+    nixlBackendReqH *handle = nullptr;
+    ASSERT_EQ (obj_engine_->prepXfer (
+                   NIXL_READ, local_descs, remote_descs, init_params_.localAgent, handle, nullptr),
+               NIXL_SUCCESS);
+    EXPECT_EQ (obj_engine_->postXfer (
+                   NIXL_READ, local_descs, remote_descs, init_params_.localAgent, handle, nullptr),
+               NIXL_IN_PROG);
+
+    mock_s3_client_->execAsync();
+    EXPECT_NE (obj_engine_->checkXfer (handle), NIXL_SUCCESS);
+    EXPECT_EQ (mock_s3_client_->getPendingCount(), 0);
+
+    obj_engine_->releaseReqH (handle);
+    obj_engine_->deregisterMem (local_metadata);
+    obj_engine_->deregisterMem (remote_metadata);
+}
+
+TEST (ObjRangeTunerTest, ChunkSizeAmortizesLatency) {
+    const size_t mib = 1024 * 1024;
+    nixlObjRangeTuner tuner (16 * mib, mib, 256 * mib);
+    EXPECT_EQ (tuner.getChunkSize(), 16 * mib);
+    EXPECT_TRUE (tuner.needsProbe());
+
+    // 20ms per request at 1GB/s, latency is a tenth of a request of 180MB
+    for (int i = 0; i < 16; ++i) {
+        size_t bytes = (i % 2 ? 8 : 4) * mib;
+        tuner.record (bytes, std::chrono::microseconds (20000 + bytes / 1000));
+    }
+    EXPECT_FALSE (tuner.needsProbe());
+    EXPECT_EQ (tuner.getChunkSize(), 172 * mib);
+
+    // A low latency endpoint brings it down to the minimum
+    for (int i = 0; i < 200; ++i) {
+        size_t bytes = (i % 2 ? 8 : 4) * mib;
+        tuner.record (bytes, std::chrono::microseconds (bytes / 1000));
+    }
+    EXPECT_EQ (tuner.getChunkSize(), mib);
+}
+
+// Packed, small objects cost a PUT per segment instead of one per object, and each
+// is read back with a ranged GET of its own range in the segment
+TEST_F (ObjTestFixture, ManySmallObjectsPacked) {
+    const int num_objects = 1000;
+    const size_t object_size = 64;
+    const size_t segment_size = 16 * 1024;
+    mock_s3_client_->setSimulateSuccess (true);
+
+    std::vector<char> buffer (num_objects * object_size);
+    for (bool packed : {false, true}) {
+        if (packed) {
+            custom_params_["pack_max_size"] = std::to_string (object_size);
+            custom_params_["pack_segment_size"] = std::to_string (segment_size);
+            resetEngine();
+        }
+
+        nixlBlobDesc local_desc;
+        local_desc.devId = 1;
+        nixlBackendMD *local_metadata = nullptr;
+        ASSERT_EQ (obj_engine_->registerMem (local_desc, DRAM_SEG, local_metadata), NIXL_SUCCESS);
+
+        nixl_meta_dlist_t local_descs (DRAM_SEG);
+        nixl_meta_dlist_t remote_descs (OBJ_SEG);
+        std::vector<nixlBackendMD *> remote_metadata (num_objects);
+        for (int i = 0; i < num_objects; ++i) {
+            nixlBlobDesc remote_desc;
+            remote_desc.devId = 100 + i;
+            remote_desc.metaInfo = "test-small-key" + std::to_string (i);
+            ASSERT_EQ (obj_engine_->registerMem (remote_desc, OBJ_SEG, remote_metadata[i]),
+                       NIXL_SUCCESS);
+            local_descs.addDesc (nixlMetaDesc (
+                reinterpret_cast<uintptr_t> (buffer.data() + i * object_size), object_size, 1));
+            remote_descs.addDesc (nixlMetaDesc (0, object_size, remote_desc.devId));
+        }
+
+        // Returns the number of requests the transfer issued
+        auto transfer = [&] (nixl_xfer_op_t operation) -> size_t {
+            nixlBackendReqH *handle = nullptr;
+            EXPECT_EQ (obj_engine_->prepXfer (operation,
+                                              local_descs,
+                                              remote_descs,
+                                              init_params_.localAgent,
+                                              handle,
+                                              nullptr),
+                       NIXL_SUCCESS);
+            EXPECT_EQ (obj_engine_->postXfer (operation,
+                                              local_descs,
+                                              remote_descs,
+                                              init_params_.localAgent,
+                                              handle,
+                                              nullptr),
+                       NIXL_IN_PROG);
+            size_t requests = mock_s3_client_->getPendingCount();
+            EXPECT_EQ (obj_engine_->checkXfer (handle), NIXL_IN_PROG);
+
+            mock_s3_client_->execAsync();
+            EXPECT_EQ (obj_engine_->checkXfer (handle), NIXL_SUCCESS);
+            obj_engine_->releaseReqH (handle);
+            return requests;
+        };
+
+        const size_t segments = (buffer.size() + segment_size - 1) / segment_size;
+        EXPECT_EQ (transfer (NIXL_WRITE), packed ? segments : num_objects);
+
+        // The mock fills GETs with a pattern of the offset in the object read, a packed
+        // object is at its offset in its segment
+        std::fill (buffer.begin(), buffer.end(), 0);
+        EXPECT_EQ (transfer (NIXL_READ), num_objects);
+        const size_t per_segment = segment_size / object_size;
+        for (int i = 0; i < num_objects; ++i) {
+            const size_t offset = packed ? (i % per_segment) * object_size : 0;
+            for (size_t j = 0; j < object_size; ++j)
+                ASSERT_EQ (buffer[i * object_size + j], static_cast<char> ('A' + (offset + j) % 26))
+                    << "object " << i << (packed ? " packed" : "");
+        }
+
+        obj_engine_->deregisterMem (local_metadata);
+        for (auto *metadata : remote_metadata)
+            obj_engine_->deregisterMem (metadata);
+    }
+}
+
+TEST_F (ObjTestFixture, PackedWritesIndexedInPostOrder) {
+    auto packer = std::make_shared<nixlObjPacker> (
+        mock_s3_client_, nixlObjPacker::params{64, 1024, 0.5, "nixl-pack/", false});
+    const std::string key = "test-packed-key";
+    std::vector<char> old_data (16, 'o'), new_data (32, 'n');
+
+    auto upload = [&] (std::vector<std::shared_ptr<nixlObjPendingSegment>> segments) {
+        for (auto &segment : segments)
+            packer->upload (std::move (segment), [] (bool success) { EXPECT_TRUE (success); });
+        mock_s3_client_->execAsync();
+    };
+    auto packedLen = [&]() -> size_t {
+        nixlObjPackedRange range;
+        for (size_t len : {new_data.size(), old_data.size()})
+            if (packer->lookup (key, 0, len, range) == NIXL_SUCCESS) {
+                packer->release (range);
+                return len;
+            }
+        return 0;
+    };
+
+    // A packed write uploaded after the later unpacked write of the key is dropped
+    auto old_segments =
+        packer->pack ({{&key, reinterpret_cast<uintptr_t> (old_data.data()), old_data.size()}});
+    packer->invalidate (key);
+    upload (std::move (old_segments));
+    EXPECT_EQ (packedLen(), 0);
+
+    // Two packed writes of the key are indexed in post order, not in upload order
+    old_segments =
+        packer->pack ({{&key, reinterpret_cast<uintptr_t> (old_data.data()), old_data.size()}});
+    auto new_segments =
+        packer->pack ({{&key, reinterpret_cast<uintptr_t> (new_data.data()), new_data.size()}});
+    upload (std::move (new_segments));
+    EXPECT_EQ (packedLen(), new_data.size());
+    upload (std::move (old_segments));
+    EXPECT_EQ (packedLen(), new_data.size());
+
+    packer->close();
+}
+
+class ObjLocalFsTest : public testing::Test {
+protected:
+    std::string root_dir_;
+    std::unique_ptr<nixlObjEngine> obj_engine_;
+    nixlBackendInitParams init_params_;
+    nixl_b_params_t custom_params_;
+
+    void
+    SetUp() override {
+        char dir_template[] = "/tmp/nixl_obj_test_XXXXXX";
+        ASSERT_NE (mkdtemp (dir_template), nullptr);
+        root_dir_ = dir_template;
+
+        custom_params_["local_dir"] = root_dir_;
+        custom_params_["multipart_part_size"] = std::to_string (5 * 1024 * 1024);
+        custom_params_["read_chunk_size"] = std::to_string (1024 * 1024);
+        init_params_.localAgent = "test-agent";
+        init_params_.type = "OBJ";
+        init_params_.customParams = &custom_params_;
+        init_params_.enableProgTh = false;
+        init_params_.pthrDelay = 0;
+        init_params_.syncMode = nixl_thread_sync_t::NIXL_THREAD_SYNC_RW;
+        obj_engine_ = std::make_unique<nixlObjEngine> (&init_params_);
+    }
+
+    void
+    TearDown() override {
+        obj_engine_.reset();
+        std::filesystem::remove_all (root_dir_);
+    }
+
+    void
+    resetEngine() {
+        obj_engine_.reset();
+        obj_engine_ = std::make_unique<nixlObjEngine> (&init_params_);
+    }
+
+    // Registers the objects <prefix><i>, with devId i + 1
+    std::vector<nixlBackendMD *>
+    registerObjects (const std::string &prefix, size_t count) {
+        std::vector<nixlBackendMD *> metadata (count);
+        for (size_t i = 0; i < count; ++i) {
+            nixlBlobDesc desc;
+            desc.devId = i + 1;
+            desc.metaInfo = prefix + std::to_string (i);
+            EXPECT_EQ (obj_engine_->registerMem (desc, OBJ_SEG, metadata[i]), NIXL_SUCCESS);
+        }
+        return metadata;
+    }
+
+    void
+    deregisterObjects (const std::vector<nixlBackendMD *> &metadata) {
+        for (auto *md : metadata)
+            obj_engine_->deregisterMem (md);
+    }
+
+    // Transfers buffers[i] to or from the object with devId i + 1, for the given objects
+    nixl_status_t
+    transferObjects (nixl_xfer_op_t operation,
+                     std::vector<std::vector<char>> &buffers,
+                     const std::vector<size_t> &objects,
+                     size_t offset = 0) {
+        nixl_meta_dlist_t local_descs (DRAM_SEG);
+        nixl_meta_dlist_t remote_descs (OBJ_SEG);
+        for (size_t i : objects) {
+            local_descs.addDesc (nixlMetaDesc (
+                reinterpret_cast<uintptr_t> (buffers[i].data()), buffers[i].size(), 0));
+            remote_descs.addDesc (nixlMetaDesc (offset, buffers[i].size(), i + 1));
+        }
+        return transfer (operation, local_descs, remote_descs);
+    }
+
+    // Total size of the files under a directory of the root, skipping files deleted meanwhile
+    size_t
+    directorySize (const std::string &dir) {
+        size_t size = 0;
+        for (const auto &entry : std::filesystem::directory_iterator (root_dir_ + "/" + dir)) {
+            std::error_code ec;
+            size_t file_size = entry.file_size (ec);
+            if (!ec) size += file_size;
+        }
+        return size;
+    }
+
+    nixl_status_t
+    transfer (nixl_xfer_op_t operation,
+              nixl_meta_dlist_t &local_descs,
+              nixl_meta_dlist_t &remote_descs) {
+        nixlBackendReqH *handle = nullptr;
+        nixl_status_t status = obj_engine_->prepXfer (
+            operation, local_descs, remote_descs, init_params_.localAgent, handle, nullptr);
+        if (status != NIXL_SUCCESS) return status;
+
+        status = obj_engine_->postXfer (
+            operation, local_descs, remote_descs, init_params_.localAgent, handle, nullptr);
+        while (status == NIXL_IN_PROG)
+            status = obj_engine_->checkXfer (handle);
+
+        obj_engine_->releaseReqH (handle);
+        return status;
+    }
+};
+
+TEST_F (ObjLocalFsTest, WriteAndReadBack) {
+    nixlBlobDesc small_desc, large_desc;
+    small_desc.devId = 1;
+    small_desc.metaInfo = "dir/small";
+    large_desc.devId = 2;
+    large_desc.metaInfo = "large";
+    nixlBackendMD *small_metadata = nullptr;
+    nixlBackendMD *large_metadata = nullptr;
+    ASSERT_EQ (obj_engine_->registerMem (small_desc, OBJ_SEG, small_metadata), NIXL_SUCCESS);
+    ASSERT_EQ (obj_engine_->registerMem (large_desc, OBJ_SEG, large_metadata), NIXL_SUCCESS);
+
+    // The large object is written in two descriptors as a 3 part multipart upload
+    std::vector<char> small (4096), large (12 * 1024 * 1024 + 100);
+    for (size_t i = 0; i < small.size(); ++i)
+        small[i] = static_cast<char> (i % 251);
+    for (size_t i = 0; i < large.size(); ++i)
+        large[i] = static_cast<char> (i * 7 % 253);
+
+    nixl_meta_dlist_t local_descs (DRAM_SEG);
+    nixl_meta_dlist_t remote_descs (OBJ_SEG);
+    const size_t split = 7 * 1024 * 1024;
+    local_descs.addDesc (
+        nixlMetaDesc (reinterpret_cast<uintptr_t> (small.data()), small.size(), 0));
+    remote_descs.addDesc (nixlMetaDesc (0, small.size(), small_desc.devId));
+    local_descs.addDesc (nixlMetaDesc (reinterpret_cast<uintptr_t> (large.data()), split, 0));
+    remote_descs.addDesc (nixlMetaDesc (0, split, large_desc.devId));
+    local_descs.addDesc (nixlMetaDesc (
+        reinterpret_cast<uintptr_t> (large.data() + split), large.size() - split, 0));
+    remote_descs.addDesc (nixlMetaDesc (split, large.size() - split, large_desc.devId));
+    ASSERT_EQ (transfer (NIXL_WRITE, local_descs, remote_descs), NIXL_SUCCESS);
+
+    EXPECT_EQ (std::filesystem::file_size (root_dir_ + "/dir/small"), small.size());
+    EXPECT_EQ (std::filesystem::file_size (root_dir_ + "/large"), large.size());
+    EXPECT_TRUE (std::filesystem::is_empty (root_dir_ + "/.multipart"));
+
+    // Read back the large object from an offset, in ranged chunks
+    const size_t offset = 1000;
+    std::vector<char> small_out (small.size()), large_out (large.size() - offset);
+    nixl_meta_dlist_t read_local (DRAM_SEG);
+    nixl_meta_dlist_t read_remote (OBJ_SEG);
+    read_local.addDesc (
+        nixlMetaDesc (reinterpret_cast<uintptr_t> (small_out.data()), small_out.size(), 0));
+    read_remote.addDesc (nixlMetaDesc (0, small_out.size(), small_desc.devId));
+    read_local.addDesc (
+        nixlMetaDesc (reinterpret_cast<uintptr_t> (large_out.data()), large_out.size(), 0));
+    read_remote.addDesc (nixlMetaDesc (offset, large_out.size(), large_desc.devId));
+    ASSERT_EQ (transfer (NIXL_READ, read_local, read_remote), NIXL_SUCCESS);
+
+    EXPECT_EQ (small_out, small);
+    EXPECT_TRUE (std::equal (large_out.begin(), large_out.end(), large.begin() + offset));
+
+    obj_engine_->deregisterMem (small_metadata);
+    obj_engine_->deregisterMem (large_metadata);
+}
+
+TEST_F (ObjLocalFsTest, ReadMissingObjectFails) {
+    nixlBlobDesc remote_desc;
+    remote_desc.devId = 1;
+    remote_desc.metaInfo = "missing";
+    nixlBackendMD *remote_metadata = nullptr;
+    ASSERT_EQ (obj_engine_->registerMem (remote_desc, OBJ_SEG, remote_metadata), NIXL_SUCCESS);
+
+    std::vector<char> buffer (1024);
+    nixl_meta_dlist_t local_descs (DRAM_SEG);
+    nixl_meta_dlist_t remote_descs (OBJ_SEG);
+    local_descs.addDesc (
+        nixlMetaDesc (reinterpret_cast<uintptr_t> (buffer.data()), buffer.size(), 0));
+    remote_descs.addDesc (nixlMetaDesc (0, buffer.size(), remote_desc.devId));
+    EXPECT_EQ (transfer (NIXL_READ, local_descs, remote_descs), NIXL_ERR_BACKEND);
+
+    obj_engine_->deregisterMem (remote_metadata);
+}
+
+TEST_F (ObjLocalFsTest, PackedWriteAndRead) {
+    custom_params_["pack_max_size"] = std::to_string (64 * 1024);
+    custom_params_["pack_segment_size"] = std::to_string (1024 * 1024);
+    resetEngine();
+
+    const size_t count = 100;
+    auto metadata = registerObjects ("kv/", count);
+    std::vector<std::vector<char>> blocks (count, std::vector<char> (4096));
+    std::vector<size_t> objects (count);
+    for (size_t i = 0; i < count; ++i) {
+        objects[i] = i;
+        for (size_t j = 0; j < blocks[i].size(); ++j)
+            blocks[i][j] = static_cast<char> ((i * 31 + j) % 251);
+    }
+    ASSERT_EQ (transferObjects (NIXL_WRITE, blocks, objects), NIXL_SUCCESS);
+
+    // One segment holds all the blocks, no object was written on its own
+    EXPECT_FALSE (std::filesystem::exists (root_dir_ + "/kv"));
+    EXPECT_EQ (std::distance (std::filesystem::directory_iterator (root_dir_ + "/nixl-pack"),
+                              std::filesystem::directory_iterator()),
+               1);
+    EXPECT_EQ (directorySize ("nixl-pack"), count * 4096);
+
+    // Ranges of the packed objects are read back
+    const size_t offset = 100;
+    std::vector<std::vector<char>> out (count, std::vector<char> (1000));
+    ASSERT_EQ (transferObjects (NIXL_READ, out, objects, offset), NIXL_SUCCESS);
+    for (size_t i = 0; i < count; ++i)
+        EXPECT_TRUE (std::equal (out[i].begin(), out[i].end(), blocks[i].begin() + offset));
+
+    // A range past the end of a packed object would read its neighbour
+    EXPECT_EQ (transferObjects (NIXL_READ, out, {0}, 3500), NIXL_ERR_INVALID_PARAM);
+
+    // Written larger than the packing limit, an object is replaced by its own file
+    std::vector<std::vector<char>> large (1, std::vector<char> (128 * 1024, 'x'));
+    ASSERT_EQ (transferObjects (NIXL_WRITE, large, {0}), NIXL_SUCCESS);
+    EXPECT_EQ (std::filesystem::file_size (root_dir_ + "/kv/0"), large[0].size());
+    std::vector<std::vector<char>> large_out (1, std::vector<char> (large[0].size()));
+    ASSERT_EQ (transferObjects (NIXL_READ, large_out, {0}), NIXL_SUCCESS);
+    EXPECT_EQ (large_out[0], large[0]);
+
+    deregisterObjects (metadata);
+}
+
+TEST_F (ObjLocalFsTest, PackedCompactionAndIndexReuse) {
+    const size_t block_size = 8 * 1024;
+    const size_t segment_size = 64 * 1024;
+    custom_params_["pack_max_size"] = std::to_string (16 * 1024);
+    custom_params_["pack_segment_size"] = std::to_string (segment_size);
+    custom_params_["pack_index"] = "true";
+    resetEngine();
+
+    // 4 segments of 8 blocks
+    const size_t count = 32;
+    auto metadata = registerObjects ("kv/", count);
+    std::vector<std::vector<char>> blocks (count, std::vector<char> (block_size));
+    std::vector<size_t> all (count), rewritten;
+    for (size_t i = 0; i < count; ++i) {
+        all[i] = i;
+        std::fill (blocks[i].begin(), blocks[i].end(), static_cast<char> (i));
+        if (i % 8 < 6) rewritten.push_back (i);
+    }
+    ASSERT_EQ (transferObjects (NIXL_WRITE, blocks, all), NIXL_SUCCESS);
+    EXPECT_EQ (directorySize ("nixl-pack"), count * block_size);
+
+    // Rewriting 6 blocks of every segment leaves them a quarter live, below the ratio
+    for (size_t i : rewritten)
+        std::fill (blocks[i].begin(), blocks[i].end(), static_cast<char> (i + 100));
+    ASSERT_EQ (transferObjects (NIXL_WRITE, blocks, rewritten), NIXL_SUCCESS);
+
+    // Without compaction the old segments would still hold 4 x 64KiB. At most one is left
+    // uncompacted, when its dead bytes alone don't add up to a segment.
+    const size_t live = count * block_size;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds (10);
+    while (directorySize ("nixl-pack") > live + segment_size &&
+           std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for (std::chrono::milliseconds (1));
+    EXPECT_LE (directorySize ("nixl-pack"), live + segment_size);
+    std::cout << "Packed segments hold " << directorySize ("nixl-pack") << " bytes for " << live
+              << " live bytes" << std::endl;
+
+    // Closing the engine saves the index
+    deregisterObjects (metadata);
+    resetEngine();
+    EXPECT_TRUE (std::filesystem::exists (root_dir_ + "/nixl-pack/index"));
+
+    // The new engine reads the objects through the saved index
+    metadata = registerObjects ("kv/", count);
+    std::vector<std::vector<char>> out (count, std::vector<char> (block_size));
+    ASSERT_EQ (transferObjects (NIXL_READ, out, all), NIXL_SUCCESS);
+    for (size_t i = 0; i < count; ++i)
+        EXPECT_EQ (out[i], blocks[i]) << "object " << i;
+
+    deregisterObjects (metadata);
+}
+
 } // namespace gtest::obj
@@ -0,0 +1,231 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Measures the bookkeeping cost of memory registration and deregistration in the
+// agent memory sections, for descriptor counts from 1k to 1M. The backend does
+// no actual registration work, so the time is spent in the sections only.
+// Then measures the startup time to register freshly allocated memory with a
+// backend that pins it, with an increasing number of registration threads.
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <cassert>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <sys/mman.h>
+
+#include "nixl.h"
+#include "mem_section.h"
+#include "backend/backend_engine.h"
+
+static const size_t page_size = 4096;
+
+class nullEngine : public nixlBackendEngine {
+    public:
+        nullEngine(const nixlBackendInitParams* init_params)
+            : nixlBackendEngine(init_params) {}
+
+        bool supportsRemote() const { return true; }
+        bool supportsLocal() const { return true; }
+        bool supportsNotif() const { return false; }
+        bool supportsProgTh() const { return false; }
+
+        nixl_mem_list_t getSupportedMems() const { return {DRAM_SEG}; }
+
+        nixl_status_t registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem,
+                                  nixlBackendMD* &out) {
+            out = new nixlBackendMD(true);
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t deregisterMem(nixlBackendMD* meta) {
+            delete meta;
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t getPublicData(const nixlBackendMD* meta, std::string &str) const {
+            str.clear();
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t loadLocalMD(nixlBackendMD* input, nixlBackendMD* &output) {
+            output = input;
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t connect(const std::string &remote_agent) { return NIXL_SUCCESS; }
+        nixl_status_t disconnect(const std::string &remote_agent) { return NIXL_SUCCESS; }
+        nixl_status_t unloadMD(nixlBackendMD* input) { return NIXL_SUCCESS; }
+
+        nixl_status_t prepXfer(const nixl_xfer_op_t &operation, const nixl_meta_dlist_t &local,
+                               const nixl_meta_dlist_t &remote, const std::string &remote_agent,
+                               nixlBackendReqH* &handle,
+                               const nixl_opt_b_args_t* opt_args=nullptr) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        nixl_status_t postXfer(const nixl_xfer_op_t &operation, const nixl_meta_dlist_t &local,
+                               const nixl_meta_dlist_t &remote, const std::string &remote_agent,
+                               nixlBackendReqH* &handle,
+                               const nixl_opt_b_args_t* opt_args=nullptr) const {
+            return NIXL_ERR_NOT_SUPPORTED;
+        }
+
+        nixl_status_t checkXfer(nixlBackendReqH* handle) const { return NIXL_ERR_NOT_SUPPORTED; }
+        nixl_status_t releaseReqH(nixlBackendReqH* handle) const { return NIXL_SUCCESS; }
+};
+
+// Pins the registered memory like an RDMA or GDS registration would
+class pinEngine : public nullEngine {
+    public:
+        using nullEngine::nullEngine;
+
+        bool supportsParallelReg() const { return true; }
+
+        nixl_status_t registerMem(const nixlBlobDesc &mem, const nixl_mem_t &nixl_mem,
+                                  nixlBackendMD* &out) {
+            if (mlock((void*) mem.addr, mem.len))
+                return NIXL_ERR_BACKEND;
+            out = new nixlBackendMD(true);
+            return NIXL_SUCCESS;
+        }
+
+        nixl_status_t deregisterMem(nixlBackendMD* meta) {
+            delete meta;
+            return NIXL_SUCCESS;
+        }
+};
+
+static double
+elapsed_ms(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - start).count();
+}
+
+// Registers the descriptors as nixlAgent::registerMem does, through the local
+// section and the self remote section, then deregisters them
+static void
+run_registration(nixlBackendEngine *engine, size_t n_descs, bool shuffle) {
+    std::vector<size_t> pages(n_descs);
+    for (size_t i = 0; i < n_descs; i++)
+        pages[i] = i;
+    if (shuffle)
+        std::shuffle(pages.begin(), pages.end(), std::mt19937(n_descs));
+
+    nixl_reg_dlist_t descs(DRAM_SEG);
+    for (auto page : pages)
+        descs.addDesc(nixlBlobDesc(0x100000 + page * page_size, page_size, 0));
+
+    nixlLocalSection local;
+    nixlRemoteSection self("self");
+    nixl_sec_dlist_t sec_descs(DRAM_SEG, false);
+    nixl_status_t status;
+
+    auto start = std::chrono::steady_clock::now();
+    status = local.addDescList(descs, engine, sec_descs);
+    assert (status == NIXL_SUCCESS);
+    status = self.loadLocalData(sec_descs, engine);
+    assert (status == NIXL_SUCCESS);
+    double reg_ms = elapsed_ms(start);
+
+    start = std::chrono::steady_clock::now();
+    status = local.remDescList(descs, engine);
+    assert (status == NIXL_SUCCESS);
+    double dereg_ms = elapsed_ms(start);
+
+    std::cout << std::setw(8) << n_descs << std::setw(10) << (shuffle ? "shuffled" : "sorted")
+              << std::setw(12) << reg_ms << std::setw(12) << n_descs / reg_ms / 1000
+              << std::setw(12) << dereg_ms << std::setw(12) << n_descs / dereg_ms / 1000
+              << std::endl;
+}
+
+static void
+run_pinned_registration(nixlBackendEngine *engine, size_t total_mb, size_t desc_kb,
+                        unsigned int n_threads, bool coalesce = false) {
+    size_t total = total_mb << 20;
+    size_t desc_size = desc_kb << 10;
+    void *buf = mmap(nullptr, total, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    assert (buf != MAP_FAILED);
+
+    nixl_reg_dlist_t descs(DRAM_SEG);
+    for (size_t offset = 0; offset < total; offset += desc_size)
+        descs.addDesc(nixlBlobDesc((uintptr_t) buf + offset, desc_size, 0));
+
+    nixlLocalSection local(coalesce);
+    nixl_sec_dlist_t sec_descs(DRAM_SEG, false);
+
+    auto start = std::chrono::steady_clock::now();
+    nixl_status_t status = local.addDescList(descs, engine, sec_descs, n_threads);
+    double reg_ms = elapsed_ms(start);
+
+    if (status != NIXL_SUCCESS) {
+        std::cout << "pinning " << total_mb << " MB failed, check the memlock limit"
+                  << std::endl;
+    } else {
+        std::cout << std::setw(8) << total_mb << std::setw(10) << descs.descCount()
+                  << std::setw(10) << n_threads << std::setw(10) << sec_descs.descCount()
+                  << std::setw(12) << reg_ms
+                  << std::setw(12) << total_mb / reg_ms * 1000 / 1024 << std::endl;
+        status = local.remDescList(descs, engine);
+        assert (status == NIXL_SUCCESS);
+    }
+
+    munmap(buf, total);
+}
+
+int main(int argc, char **argv) {
+    size_t max_descs = (argc > 1) ? strtoull(argv[1], nullptr, 10) : 1000000;
+    size_t pin_mb    = (argc > 2) ? strtoull(argv[2], nullptr, 10) : 1024;
+
+    nixlBackendInitParams params;
+    nixl_b_params_t custom_params;
+    params.localAgent   = "self";
+    params.type         = "NULL";
+    params.customParams = &custom_params;
+    params.enableProgTh = false;
+    params.pthrDelay    = 0;
+    params.syncMode     = nixl_thread_sync_t::NIXL_THREAD_SYNC_NONE;
+
+    nullEngine engine(&params);
+
+    std::cout << std::fixed << std::setprecision(2)
+              << std::setw(8) << "descs" << std::setw(10) << "order"
+              << std::setw(12) << "reg(ms)" << std::setw(12) << "reg(M/s)"
+              << std::setw(12) << "dereg(ms)" << std::setw(12) << "dereg(M/s)" << std::endl;
+    for (size_t n_descs = 1000; n_descs <= max_descs; n_descs *= 10) {
+        run_registration(&engine, n_descs, false);
+        run_registration(&engine, n_descs, true);
+    }
+
+    pinEngine pin_engine(&params);
+
+    std::cout << std::endl
+              << std::setw(8) << "MB" << std::setw(10) << "descs"
+              << std::setw(10) << "threads" << std::setw(10) << "entries"
+              << std::setw(12) << "reg(ms)"
+              << std::setw(12) << "reg(GB/s)" << std::endl;
+    for (unsigned int n_threads = 1; n_threads <= 16; n_threads *= 2)
+        run_pinned_registration(&pin_engine, pin_mb, 2048, n_threads);
+    // Adjacent descriptors coalesced into a single registration
+    run_pinned_registration(&pin_engine, pin_mb, 2048, 1, true);
+
+    return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Compares the target side completion latency of a write when signalled
+// through a notification versus an atomic increment of a remote counter.
+
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <chrono>
+#include <atomic>
+
+#include "nixl.h"
+
+static const std::string initiator("Initiator");
+static const std::string target("Target");
+static const std::string notif_msg("done");
+
+static const int n_warmup = 100;
+static const int n_iters  = 10000;
+
+enum completion_mode_t { MODE_NOTIF, MODE_COUNTER };
+
+static double
+run_latency(nixlAgent &A1, nixlAgent &A2, completion_mode_t mode,
+            void* src_buf, void* dst_buf, size_t len, uint64_t* counter) {
+    nixl_xfer_dlist_t src_list(DRAM_SEG), dst_list(DRAM_SEG);
+    nixl_opt_args_t extra_params;
+    nixlXferReqH* req;
+    nixl_status_t status;
+
+    src_list.addDesc(nixlBasicDesc((uintptr_t) src_buf, len, 0));
+    dst_list.addDesc(nixlBasicDesc((uintptr_t) dst_buf, len, 0));
+
+    if (mode == MODE_NOTIF) {
+        extra_params.hasNotif = true;
+        extra_params.notifMsg = notif_msg;
+    } else {
+        extra_params.hasRemoteCounter  = true;
+        extra_params.remoteCounterAddr = (uintptr_t) counter;
+        extra_params.remoteCounterMem  = DRAM_SEG;
+    }
+
+    status = A1.createXferReq(NIXL_WRITE, src_list, dst_list, target, req, &extra_params);
+    assert (status == NIXL_SUCCESS);
+
+    // Counter is updated by the NIC or a remote process, not by this program
+    volatile uint64_t* counter_ref = counter;
+    uint64_t expected = *counter_ref;
+    std::chrono::nanoseconds total(0);
+
+    for (int i = 0; i < n_warmup + n_iters; i++) {
+        auto start = std::chrono::steady_clock::now();
+
+        status = A1.postXferReq(req);
+        assert (status >= NIXL_SUCCESS);
+
+        // Target side waits for completion, initiator keeps progressing its request
+        if (mode == MODE_NOTIF) {
+            nixl_notifs_t notif_map;
+            while (notif_map[initiator].empty()) {
+                status = A2.getNotifs(notif_map);
+                assert (status == NIXL_SUCCESS);
+                if (A1.getXferStatus(req) < 0)
+                    assert (false);
+            }
+        } else {
+            expected++;
+            while (*counter_ref != expected) {
+                if (A1.getXferStatus(req) < 0)
+                    assert (false);
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+        }
+
+        if (i >= n_warmup)
+            total += std::chrono::steady_clock::now() - start;
+
+        // Don't repost while the local side is still in progress
+        while ((status = A1.getXferStatus(req)) == NIXL_IN_PROG);
+        assert (status == NIXL_SUCCESS);
+    }
+
+    status = A1.releaseXferReq(req);
+    assert (status == NIXL_SUCCESS);
+
+    return std::chrono::duration<double, std::micro>(total).count() / n_iters;
+}
+
+int main() {
+    nixlAgentConfig cfg(false);
+    nixlAgent A1(initiator, cfg);
+    nixlAgent A2(target, cfg);
+    nixl_b_params_t init1, init2;
+    nixl_mem_list_t mems1, mems2;
+    nixlBackendH *ucx1, *ucx2;
+    nixl_status_t status;
+
+    status = A1.getPluginParams("UCX", mems1, init1);
+    assert (status == NIXL_SUCCESS);
+    status = A2.getPluginParams("UCX", mems2, init2);
+    assert (status == NIXL_SUCCESS);
+
+    status = A1.createBackend("UCX", init1, ucx1);
+    assert (status == NIXL_SUCCESS);
+    status = A2.createBackend("UCX", init2, ucx2);
+    assert (status == NIXL_SUCCESS);
+
+    const size_t max_len = 1 << 20;
+    void* src_buf = calloc(1, max_len);
+    void* dst_buf = calloc(1, max_len);
+    uint64_t* counter = (uint64_t*) aligned_alloc(sizeof(uint64_t), sizeof(uint64_t));
+    *counter = 0;
+
+    nixl_reg_dlist_t src_reg(DRAM_SEG), dst_reg(DRAM_SEG);
+    src_reg.addDesc(nixlBlobDesc((uintptr_t) src_buf, max_len, 0));
+    dst_reg.addDesc(nixlBlobDesc((uintptr_t) dst_buf, max_len, 0));
+    dst_reg.addDesc(nixlBlobDesc((uintptr_t) counter, sizeof(uint64_t), 0));
+
+    status = A1.registerMem(src_reg);
+    assert (status == NIXL_SUCCESS);
+    status = A2.registerMem(dst_reg);
+    assert (status == NIXL_SUCCESS);
+
+    std::string meta2, remote_name;
+    status = A2.getLocalMD(meta2);
+    assert (status == NIXL_SUCCESS);
+    status = A1.loadRemoteMD(meta2, remote_name);
+    assert (status == NIXL_SUCCESS);
+
+    std::string meta1;
+    status = A1.getLocalMD(meta1);
+    assert (status == NIXL_SUCCESS);
+    status = A2.loadRemoteMD(meta1, remote_name);
+    assert (status == NIXL_SUCCESS);
+
+    std::cout << "size(B)\tnotif(us)\tcounter(us)\n";
+    for (size_t len = 8; len <= max_len; len *= 8) {
+        double notif_lat   = run_latency(A1, A2, MODE_NOTIF, src_buf, dst_buf, len, counter);
+        double counter_lat = run_latency(A1, A2, MODE_COUNTER, src_buf, dst_buf, len, counter);
+        std::cout << len << "\t" << notif_lat << "\t\t" << counter_lat << "\n";
+    }
+
+    status = A1.invalidateRemoteMD(target);
+    assert (status == NIXL_SUCCESS);
+    status = A2.invalidateRemoteMD(initiator);
+    assert (status == NIXL_SUCCESS);
+
+    status = A1.deregisterMem(src_reg);
+    assert (status == NIXL_SUCCESS);
+    status = A2.deregisterMem(dst_reg);
+    assert (status == NIXL_SUCCESS);
+
+    free(src_buf);
+    free(dst_buf);
+    free(counter);
+
+    return 0;
+}
@@ -14,6 +14,7 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <unistd.h>
@@ -62,6 +63,31 @@ namespace {
 
     constexpr char default_test_files_dir_path[] = "tmp/testfiles";
 
+    enum class posix_api_t { AIO, URING, LINUX_AIO, THREADPOOL };
+
+    const char *
+    api_name (posix_api_t api) {
+        switch (api) {
+        case posix_api_t::URING:
+            return "io_uring";
+        case posix_api_t::LINUX_AIO:
+            return "Linux AIO";
+        case posix_api_t::THREADPOOL:
+            return "thread pool";
+        default:
+            return "AIO";
+        }
+    }
+
+    // Explicitly request one of the queue types of the backend
+    void
+    set_api_params (nixl_b_params_t &params, posix_api_t api) {
+        params["use_aio"] = (api == posix_api_t::AIO) ? "true" : "false";
+        params["use_uring"] = (api == posix_api_t::URING) ? "true" : "false";
+        params["use_linux_aio"] = (api == posix_api_t::LINUX_AIO) ? "true" : "false";
+        params["use_thread_pool"] = (api == posix_api_t::THREADPOOL) ? "true" : "false";
+    }
+
     // Custom deleter for posix_memalign allocated memory
     struct PosixMemalignDeleter {
         void operator()(void* ptr) const {
@@ -197,7 +223,7 @@ read_write_test (int num_transfers,
                  size_t transfer_size,
                  std::string test_files_dir_path_abs_path,
                  bool use_direct_io,
-                 bool use_uring) {
+                 posix_api_t api) {
     // If using O_DIRECT, align transfer size to page size
     if (use_direct_io) {
         if (transfer_size % page_size != 0) {
@@ -210,15 +236,7 @@ read_write_test (int num_transfers,
 
     // Set up backend parameters
     nixl_b_params_t params;
-    if (use_uring) {
-        // Explicitly request io_uring
-        params["use_uring"] = "true";
-        params["use_aio"] = "false";
-    } else {
-        // Explicitly request AIO
-        params["use_aio"] = "true";
-        params["use_uring"] = "false";
-    }
+    set_api_params (params, api);
 
     if (use_direct_io) {
         params["use_direct_io"] = "true";
@@ -232,7 +250,7 @@ read_write_test (int num_transfers,
     std::cout << absl::StrFormat ("- Total data: %.2f GB\n",
                                   (float (transfer_size) * num_transfers) / gb_size);
     std::cout << absl::StrFormat ("- Directory: %s\n", test_files_dir_path_abs_path);
-    std::cout << absl::StrFormat ("- Backend: %s\n", use_uring ? "io_uring" : "AIO");
+    std::cout << absl::StrFormat ("- Backend: %s\n", api_name (api));
     std::cout << absl::StrFormat ("- Direct I/O: %s\n", use_direct_io ? "enabled" : "disabled");
     std::cout << std::endl;
     std::cout << line_str << std::endl;
@@ -245,7 +263,7 @@ read_write_test (int num_transfers,
         std::cerr << center_str("ERROR: Backend Creation Failed") << std::endl;
         std::cerr << line_str << std::endl;
         std::cerr << "Error creating POSIX backend: " << nixlEnumStrings::statusStr(status) << std::endl;
-        if (use_uring) {
+        if (api == posix_api_t::URING) {
             std::cerr << "io_uring was requested but may not be available. Try running without -U flag to use AIO instead." << std::endl;
         }
         std::cerr << std::endl << line_str << std::endl;
@@ -486,20 +504,12 @@ read_write_test (int num_transfers,
 }
 
 int
-test_posix_repost (std::string test_files_dir_path_abs_path, bool use_uring) {
+test_posix_repost (std::string test_files_dir_path_abs_path, posix_api_t api) {
     constexpr int num_transfers = 16;
     constexpr size_t transfer_size = 128 * 1024; // 128KB
     // Set up backend parameters
     nixl_b_params_t params;
-    if (use_uring) {
-        // Explicitly request io_uring
-        params["use_uring"] = "true";
-        params["use_aio"] = "false";
-    } else {
-        // Explicitly request AIO
-        params["use_aio"] = "true";
-        params["use_uring"] = "false";
-    }
+    set_api_params (params, api);
 
     print_segment_title ("NIXL STORAGE REPOST TEST STARTING (POSIX PLUGIN)");
 
@@ -740,6 +750,585 @@ test_posix_repost (std::string test_files_dir_path_abs_path, bool use_uring) {
     return 0;
 }
 
+// Push many more descriptors than the ring depth and in-flight limit through
+// a single request, the queue has to keep refilling as completions arrive
+int
+test_posix_sliding_window (std::string test_files_dir_path_abs_path, posix_api_t api) {
+    constexpr int num_descs = 1024 * 1024;
+    constexpr size_t desc_size = 16;
+    constexpr size_t buffer_size = num_descs * desc_size;
+    nixl_b_params_t params;
+    set_api_params (params, api);
+    if (api == posix_api_t::URING) {
+        params["uring_queue_depth"] = "256";
+    }
+    params["max_inflight"] = "256";
+    // Adjacent descriptors would be merged into a few large I/Os otherwise
+    params["coalesce_io"] = "false";
+
+    print_segment_title ("NIXL STORAGE SLIDING WINDOW TEST STARTING (POSIX PLUGIN)");
+    std::cout << absl::StrFormat ("- Descriptors: %d of %zu bytes, 256 in flight\n", num_descs,
+                                  desc_size);
+
+    nixlBackendH *posix = nullptr;
+    nixlAgent agent ("POSIXWindowTester", nixlAgentConfig (true));
+    if (agent.createBackend ("POSIX", params, posix) != NIXL_SUCCESS) {
+        std::cerr << "Failed to create POSIX backend" << std::endl;
+        return 1;
+    }
+
+    print_segment_title (phase_title ("Allocating and initializing buffers"));
+    std::vector<char> src (buffer_size);
+    std::vector<char> dst (buffer_size, 0);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        src[i] = static_cast<char> ((i * 7) % 251);
+    }
+
+    std::string file_path = test_files_dir_path_abs_path + "/" +
+        generate_timestamped_filename (test_file_name) + "_window";
+    std::unique_ptr<tempFile> file;
+    try {
+        file = std::make_unique<tempFile> (file_path, O_RDWR | O_CREAT, std_file_permissions);
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Failed to open file: " << file_path << " - " << e.what() << std::endl;
+        return 1;
+    }
+
+    nixl_reg_dlist_t src_reg (DRAM_SEG), dst_reg (DRAM_SEG), file_reg (FILE_SEG);
+    src_reg.addDesc (nixlBlobDesc ((uintptr_t)src.data(), buffer_size, 0));
+    dst_reg.addDesc (nixlBlobDesc ((uintptr_t)dst.data(), buffer_size, 0));
+    file_reg.addDesc (nixlBlobDesc (0, buffer_size, file->fd));
+
+    nixl_xfer_dlist_t src_xfer (DRAM_SEG), dst_xfer (DRAM_SEG), file_xfer (FILE_SEG);
+    for (int i = 0; i < num_descs; ++i) {
+        src_xfer.addDesc (nixlBasicDesc ((uintptr_t)src.data() + i * desc_size, desc_size, 0));
+        dst_xfer.addDesc (nixlBasicDesc ((uintptr_t)dst.data() + i * desc_size, desc_size, 0));
+        file_xfer.addDesc (nixlBasicDesc (i * desc_size, desc_size, file->fd));
+    }
+
+    if (agent.registerMem (src_reg) != NIXL_SUCCESS ||
+        agent.registerMem (dst_reg) != NIXL_SUCCESS ||
+        agent.registerMem (file_reg) != NIXL_SUCCESS) {
+        std::cerr << "Failed to register memory with NIXL" << std::endl;
+        return 1;
+    }
+
+    const std::pair<nixl_xfer_op_t, nixl_xfer_dlist_t *> phases[] = {
+        {NIXL_WRITE, &src_xfer}, {NIXL_READ, &dst_xfer}};
+    for (const auto &[op, dram_xfer] : phases) {
+        print_segment_title (phase_title (op == NIXL_WRITE ? "Memory to File Transfer" :
+                                                             "File to Memory Transfer"));
+        nixlXferReqH *treq = nullptr;
+        nixl_status_t status =
+            agent.createXferReq (op, *dram_xfer, file_xfer, "POSIXWindowTester", treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Failed to create transfer request - status: "
+                      << nixlEnumStrings::statusStr (status) << std::endl;
+            return 1;
+        }
+
+        nixlTime::us_t time_start = nixlTime::getUs();
+        status = agent.postXferReq (treq);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus (treq);
+        }
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Transfer failed - status: " << nixlEnumStrings::statusStr (status)
+                      << std::endl;
+            agent.releaseXferReq (treq);
+            return 1;
+        }
+        std::cout << "- Time: " << format_duration (nixlTime::getUs() - time_start) << std::endl;
+        agent.releaseXferReq (treq);
+    }
+
+    print_segment_title (phase_title ("Validating read data"));
+    if (src != dst) {
+        std::cerr << "Read data doesn't match written data" << std::endl;
+        return 1;
+    }
+    std::cout << "Validation passed" << std::endl;
+
+    agent.deregisterMem (file_reg);
+    agent.deregisterMem (dst_reg);
+    agent.deregisterMem (src_reg);
+
+    return 0;
+}
+
+// Pages scattered in DRAM and contiguous in the file, as paged KV blocks written to
+// a cache file. Runs of adjacent file extents are merged into vectored I/Os, a hole
+// in the file and the IOV_MAX cap split them.
+int
+test_posix_coalesce (std::string test_files_dir_path_abs_path, posix_api_t api) {
+    constexpr int num_descs = 3000;
+    constexpr int hole_at = 1500;
+    const size_t desc_size = page_size;
+    const size_t buffer_size = num_descs * desc_size;
+    nixl_b_params_t params;
+    set_api_params (params, api);
+
+    print_segment_title ("NIXL STORAGE COALESCE TEST STARTING (POSIX PLUGIN)");
+
+    nixlBackendH *posix = nullptr;
+    nixlAgent agent ("POSIXCoalesceTester", nixlAgentConfig (true));
+    if (agent.createBackend ("POSIX", params, posix) != NIXL_SUCCESS) {
+        std::cerr << "Failed to create POSIX backend" << std::endl;
+        return 1;
+    }
+
+    print_segment_title (phase_title ("Allocating and initializing buffers"));
+    std::vector<char> src (buffer_size);
+    std::vector<char> dst (buffer_size, 0);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        src[i] = static_cast<char> ((i * 7) % 251);
+    }
+
+    std::string file_path = test_files_dir_path_abs_path + "/" +
+        generate_timestamped_filename (test_file_name) + "_coalesce";
+    std::unique_ptr<tempFile> file;
+    try {
+        file = std::make_unique<tempFile> (file_path, O_RDWR | O_CREAT, std_file_permissions);
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Failed to open file: " << file_path << " - " << e.what() << std::endl;
+        return 1;
+    }
+
+    nixl_reg_dlist_t src_reg (DRAM_SEG), dst_reg (DRAM_SEG), file_reg (FILE_SEG);
+    src_reg.addDesc (nixlBlobDesc ((uintptr_t)src.data(), buffer_size, 0));
+    dst_reg.addDesc (nixlBlobDesc ((uintptr_t)dst.data(), buffer_size, 0));
+    file_reg.addDesc (nixlBlobDesc (0, buffer_size + desc_size, file->fd));
+
+    nixl_xfer_dlist_t src_xfer (DRAM_SEG), dst_xfer (DRAM_SEG), file_xfer (FILE_SEG);
+    for (int i = 0; i < num_descs; ++i) {
+        // Pages in reverse order in DRAM, one page hole in the file
+        size_t page = num_descs - 1 - i;
+        size_t file_offset = (i < hole_at ? i : i + 1) * desc_size;
+        src_xfer.addDesc (nixlBasicDesc ((uintptr_t)src.data() + page * desc_size, desc_size, 0));
+        dst_xfer.addDesc (nixlBasicDesc ((uintptr_t)dst.data() + page * desc_size, desc_size, 0));
+        file_xfer.addDesc (nixlBasicDesc (file_offset, desc_size, file->fd));
+    }
+
+    if (agent.registerMem (src_reg) != NIXL_SUCCESS ||
+        agent.registerMem (dst_reg) != NIXL_SUCCESS ||
+        agent.registerMem (file_reg) != NIXL_SUCCESS) {
+        std::cerr << "Failed to register memory with NIXL" << std::endl;
+        return 1;
+    }
+
+    const std::pair<nixl_xfer_op_t, nixl_xfer_dlist_t *> phases[] = {
+        {NIXL_WRITE, &src_xfer}, {NIXL_READ, &dst_xfer}};
+    for (const auto &[op, dram_xfer] : phases) {
+        print_segment_title (phase_title (op == NIXL_WRITE ? "Memory to File Transfer" :
+                                                             "File to Memory Transfer"));
+        nixlXferReqH *treq = nullptr;
+        nixl_status_t status =
+            agent.createXferReq (op, *dram_xfer, file_xfer, "POSIXCoalesceTester", treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Failed to create transfer request - status: "
+                      << nixlEnumStrings::statusStr (status) << std::endl;
+            return 1;
+        }
+
+        status = agent.postXferReq (treq);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus (treq);
+        }
+        agent.releaseXferReq (treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Transfer failed - status: " << nixlEnumStrings::statusStr (status)
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    print_segment_title (phase_title ("Validating read data"));
+    if (src != dst) {
+        std::cerr << "Read data doesn't match written data" << std::endl;
+        return 1;
+    }
+    std::cout << "Validation passed" << std::endl;
+
+    agent.deregisterMem (file_reg);
+    agent.deregisterMem (dst_reg);
+    agent.deregisterMem (src_reg);
+
+    return 0;
+}
+
+// Records neither aligned in DRAM nor in an O_DIRECT file, as small KV blocks packed
+// in a cache file. Their unaligned parts go through bounce blocks, writes must keep
+// the bytes between the records.
+int
+test_posix_direct_unaligned (std::string test_files_dir_path_abs_path, posix_api_t api) {
+    constexpr int num_descs = 1000;
+    constexpr size_t desc_size = 700;
+    constexpr size_t desc_stride = 1000;
+    constexpr size_t file_start = 100;
+    constexpr char gap_fill = 'x';
+    const size_t buffer_size = num_descs * desc_size;
+    const size_t file_size = file_start + num_descs * desc_stride;
+    nixl_b_params_t params;
+    set_api_params (params, api);
+
+    print_segment_title ("NIXL STORAGE UNALIGNED O_DIRECT TEST STARTING (POSIX PLUGIN)");
+
+    std::string file_path = test_files_dir_path_abs_path + "/" +
+        generate_timestamped_filename (test_file_name) + "_direct";
+    std::unique_ptr<tempFile> file;
+    try {
+        file = std::make_unique<tempFile> (file_path, O_RDWR | O_CREAT | O_DIRECT,
+                                           std_file_permissions);
+    }
+    catch (const std::exception &e) {
+        std::cout << "Skipping, O_DIRECT not supported in " << test_files_dir_path_abs_path
+                  << std::endl;
+        return 0;
+    }
+
+    // Fill the file with buffered I/O, the records are written in between
+    {
+        std::vector<char> fill (file_size, gap_fill);
+        int fill_fd = open (file_path.c_str(), O_WRONLY);
+        if (fill_fd < 0 || pwrite (fill_fd, fill.data(), file_size, 0) != (ssize_t)file_size) {
+            std::cerr << "Failed to fill file: " << file_path << std::endl;
+            return 1;
+        }
+        close (fill_fd);
+    }
+
+    nixlBackendH *posix = nullptr;
+    nixlAgent agent ("POSIXDirectTester", nixlAgentConfig (true));
+    if (agent.createBackend ("POSIX", params, posix) != NIXL_SUCCESS) {
+        std::cerr << "Failed to create POSIX backend" << std::endl;
+        return 1;
+    }
+
+    print_segment_title (phase_title ("Allocating and initializing buffers"));
+    // Odd start so no record is aligned in DRAM either
+    std::vector<char> src (buffer_size + 1);
+    std::vector<char> dst (buffer_size + 1, 0);
+    for (size_t i = 0; i < src.size(); ++i) {
+        src[i] = static_cast<char> ((i * 7) % 251);
+    }
+
+    nixl_reg_dlist_t src_reg (DRAM_SEG), dst_reg (DRAM_SEG), file_reg (FILE_SEG);
+    src_reg.addDesc (nixlBlobDesc ((uintptr_t)src.data(), src.size(), 0));
+    dst_reg.addDesc (nixlBlobDesc ((uintptr_t)dst.data(), dst.size(), 0));
+    file_reg.addDesc (nixlBlobDesc (0, file_size, file->fd));
+
+    nixl_xfer_dlist_t src_xfer (DRAM_SEG), dst_xfer (DRAM_SEG), file_xfer (FILE_SEG);
+    for (int i = 0; i < num_descs; ++i) {
+        size_t mem_offset = 1 + i * desc_size;
+        src_xfer.addDesc (nixlBasicDesc ((uintptr_t)src.data() + mem_offset, desc_size, 0));
+        dst_xfer.addDesc (nixlBasicDesc ((uintptr_t)dst.data() + mem_offset, desc_size, 0));
+        file_xfer.addDesc (nixlBasicDesc (file_start + i * desc_stride, desc_size, file->fd));
+    }
+
+    if (agent.registerMem (src_reg) != NIXL_SUCCESS ||
+        agent.registerMem (dst_reg) != NIXL_SUCCESS ||
+        agent.registerMem (file_reg) != NIXL_SUCCESS) {
+        std::cerr << "Failed to register memory with NIXL" << std::endl;
+        return 1;
+    }
+
+    const std::pair<nixl_xfer_op_t, nixl_xfer_dlist_t *> phases[] = {
+        {NIXL_WRITE, &src_xfer}, {NIXL_READ, &dst_xfer}};
+    for (const auto &[op, dram_xfer] : phases) {
+        print_segment_title (phase_title (op == NIXL_WRITE ? "Memory to File Transfer" :
+                                                             "File to Memory Transfer"));
+        nixlXferReqH *treq = nullptr;
+        nixl_status_t status =
+            agent.createXferReq (op, *dram_xfer, file_xfer, "POSIXDirectTester", treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Failed to create transfer request - status: "
+                      << nixlEnumStrings::statusStr (status) << std::endl;
+            return 1;
+        }
+
+        status = agent.postXferReq (treq);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus (treq);
+        }
+        agent.releaseXferReq (treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Transfer failed - status: " << nixlEnumStrings::statusStr (status)
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    print_segment_title (phase_title ("Validating read data"));
+    if (memcmp (src.data() + 1, dst.data() + 1, buffer_size) != 0) {
+        std::cerr << "Read data doesn't match written data" << std::endl;
+        return 1;
+    }
+
+    std::vector<char> contents (file_size);
+    int check_fd = open (file_path.c_str(), O_RDONLY);
+    if (check_fd < 0 || pread (check_fd, contents.data(), file_size, 0) != (ssize_t)file_size) {
+        std::cerr << "Failed to read back file: " << file_path << std::endl;
+        return 1;
+    }
+    close (check_fd);
+    for (size_t offset = 0; offset < file_size; ++offset) {
+        bool in_record = offset >= file_start &&
+            (offset - file_start) % desc_stride < desc_size;
+        if (!in_record && contents[offset] != gap_fill) {
+            std::cerr << "Bytes between records overwritten at offset " << offset << std::endl;
+            return 1;
+        }
+    }
+
+    // The padded bounce block at the end of file must not grow it
+    struct stat st;
+    if (fstat (file->fd, &st) != 0 || st.st_size != (off_t)file_size) {
+        std::cerr << "File size changed by the write: " << st.st_size << " instead of "
+                  << file_size << std::endl;
+        return 1;
+    }
+    std::cout << "Validation passed" << std::endl;
+
+    agent.deregisterMem (file_reg);
+    agent.deregisterMem (dst_reg);
+    agent.deregisterMem (src_reg);
+
+    return 0;
+}
+
+// A prefetch is a read request with the "prefetch" custom param, it only warms up
+// the page cache and must leave the DRAM buffer untouched until the real read.
+int
+test_posix_prefetch (std::string test_files_dir_path_abs_path, posix_api_t api) {
+    constexpr int num_descs = 64;
+    constexpr size_t desc_size = 256 * 1024;
+    const size_t buffer_size = num_descs * desc_size;
+    nixl_b_params_t params;
+    set_api_params (params, api);
+
+    print_segment_title ("NIXL STORAGE PREFETCH TEST STARTING (POSIX PLUGIN)");
+
+    nixlBackendH *posix = nullptr;
+    nixlAgent agent ("POSIXPrefetchTester", nixlAgentConfig (true));
+    if (agent.createBackend ("POSIX", params, posix) != NIXL_SUCCESS) {
+        std::cerr << "Failed to create POSIX backend" << std::endl;
+        return 1;
+    }
+
+    print_segment_title (phase_title ("Allocating and initializing buffers"));
+    std::vector<char> src (buffer_size);
+    std::vector<char> dst (buffer_size, 0);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        src[i] = static_cast<char> ((i * 7) % 251);
+    }
+
+    std::string file_path = test_files_dir_path_abs_path + "/" +
+        generate_timestamped_filename (test_file_name) + "_prefetch";
+    std::unique_ptr<tempFile> file;
+    try {
+        file = std::make_unique<tempFile> (file_path, O_RDWR | O_CREAT, std_file_permissions);
+    }
+    catch (const std::exception &e) {
+        std::cerr << "Failed to open file: " << file_path << " - " << e.what() << std::endl;
+        return 1;
+    }
+
+    // Write the file out and drop it from the page cache
+    if (pwrite (file->fd, src.data(), buffer_size, 0) != (ssize_t)buffer_size ||
+        fsync (file->fd) != 0) {
+        std::cerr << "Failed to write file: " << file_path << std::endl;
+        return 1;
+    }
+    posix_fadvise (file->fd, 0, buffer_size, POSIX_FADV_DONTNEED);
+
+    nixl_reg_dlist_t dst_reg (DRAM_SEG), file_reg (FILE_SEG);
+    dst_reg.addDesc (nixlBlobDesc ((uintptr_t)dst.data(), buffer_size, 0));
+    file_reg.addDesc (nixlBlobDesc (0, buffer_size, file->fd));
+
+    nixl_xfer_dlist_t dst_xfer (DRAM_SEG), file_xfer (FILE_SEG);
+    for (int i = 0; i < num_descs; ++i) {
+        dst_xfer.addDesc (nixlBasicDesc ((uintptr_t)dst.data() + i * desc_size, desc_size, 0));
+        file_xfer.addDesc (nixlBasicDesc (i * desc_size, desc_size, file->fd));
+    }
+
+    if (agent.registerMem (dst_reg) != NIXL_SUCCESS ||
+        agent.registerMem (file_reg) != NIXL_SUCCESS) {
+        std::cerr << "Failed to register memory with NIXL" << std::endl;
+        return 1;
+    }
+
+    nixl_opt_args_t prefetch_args;
+    prefetch_args.customParam = "prefetch";
+    const std::pair<const char *, nixl_opt_args_t *> phases[] = {
+        {"Prefetch File", &prefetch_args}, {"File to Memory Transfer", nullptr}};
+    for (const auto &[title, extra_params] : phases) {
+        print_segment_title (phase_title (title));
+        nixlXferReqH *treq = nullptr;
+        nixl_status_t status = agent.createXferReq (
+            NIXL_READ, dst_xfer, file_xfer, "POSIXPrefetchTester", treq, extra_params);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Failed to create transfer request - status: "
+                      << nixlEnumStrings::statusStr (status) << std::endl;
+            return 1;
+        }
+
+        nixlTime::us_t start = nixlTime::getUs();
+        status = agent.postXferReq (treq);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus (treq);
+        }
+        nixlTime::us_t duration = nixlTime::getUs() - start;
+        agent.releaseXferReq (treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Transfer failed - status: " << nixlEnumStrings::statusStr (status)
+                      << std::endl;
+            return 1;
+        }
+        std::cout << absl::StrFormat ("%s took %.3f ms", title, duration / 1000.0) << std::endl;
+
+        if (extra_params &&
+            std::any_of (dst.begin(), dst.end(), [](char c) { return c != 0; })) {
+            std::cerr << "Prefetch wrote to the DRAM buffer" << std::endl;
+            return 1;
+        }
+    }
+
+    print_segment_title (phase_title ("Validating read data"));
+    if (src != dst) {
+        std::cerr << "Read data doesn't match written data" << std::endl;
+        return 1;
+    }
+    std::cout << "Validation passed" << std::endl;
+
+    agent.deregisterMem (file_reg);
+    agent.deregisterMem (dst_reg);
+
+    return 0;
+}
+
+// One FILE_SEG striped over several files: descriptors crossing stripe boundaries
+// are split over the member files, which hold every num_files-th stripe.
+int
+test_posix_striped (std::string test_files_dir_path_abs_path, posix_api_t api) {
+    constexpr int num_files = 4;
+    constexpr size_t stripe_unit = 64 * 1024;
+    constexpr int num_stripes = 64;
+    constexpr uint64_t striped_dev_id = 1000;
+    const size_t buffer_size = num_stripes * stripe_unit;
+    const size_t desc_size = 3 * stripe_unit + 4321;
+    nixl_b_params_t params;
+    set_api_params (params, api);
+
+    print_segment_title ("NIXL STORAGE STRIPED FILE TEST STARTING (POSIX PLUGIN)");
+
+    nixlBackendH *posix = nullptr;
+    nixlAgent agent ("POSIXStripeTester", nixlAgentConfig (true));
+    if (agent.createBackend ("POSIX", params, posix) != NIXL_SUCCESS) {
+        std::cerr << "Failed to create POSIX backend" << std::endl;
+        return 1;
+    }
+
+    print_segment_title (phase_title ("Allocating and initializing buffers"));
+    std::vector<char> src (buffer_size);
+    std::vector<char> dst (buffer_size, 0);
+    for (size_t i = 0; i < buffer_size; ++i) {
+        src[i] = static_cast<char> ((i * 7) % 251);
+    }
+
+    std::vector<tempFile> files;
+    std::string stripe_spec = "stripe:" + std::to_string (stripe_unit) + ":";
+    for (int i = 0; i < num_files; ++i) {
+        std::string file_path = test_files_dir_path_abs_path + "/" +
+            generate_timestamped_filename (test_file_name) + "_stripe_" + std::to_string (i);
+        try {
+            files.emplace_back (file_path, O_RDWR | O_CREAT, std_file_permissions);
+        }
+        catch (const std::exception &e) {
+            std::cerr << "Failed to open file: " << file_path << " - " << e.what() << std::endl;
+            return 1;
+        }
+        stripe_spec += (i ? "," : "") + std::to_string (files.back().fd);
+    }
+
+    nixl_reg_dlist_t src_reg (DRAM_SEG), dst_reg (DRAM_SEG), file_reg (FILE_SEG);
+    src_reg.addDesc (nixlBlobDesc ((uintptr_t)src.data(), buffer_size, 0));
+    dst_reg.addDesc (nixlBlobDesc ((uintptr_t)dst.data(), buffer_size, 0));
+    file_reg.addDesc (nixlBlobDesc (0, buffer_size, striped_dev_id, stripe_spec));
+
+    nixl_xfer_dlist_t src_xfer (DRAM_SEG), dst_xfer (DRAM_SEG), file_xfer (FILE_SEG);
+    for (size_t offset = 0; offset < buffer_size; offset += desc_size) {
+        size_t len = std::min (desc_size, buffer_size - offset);
+        src_xfer.addDesc (nixlBasicDesc ((uintptr_t)src.data() + offset, len, 0));
+        dst_xfer.addDesc (nixlBasicDesc ((uintptr_t)dst.data() + offset, len, 0));
+        file_xfer.addDesc (nixlBasicDesc (offset, len, striped_dev_id));
+    }
+
+    if (agent.registerMem (src_reg) != NIXL_SUCCESS ||
+        agent.registerMem (dst_reg) != NIXL_SUCCESS ||
+        agent.registerMem (file_reg) != NIXL_SUCCESS) {
+        std::cerr << "Failed to register memory with NIXL" << std::endl;
+        return 1;
+    }
+
+    const std::pair<nixl_xfer_op_t, nixl_xfer_dlist_t *> phases[] = {
+        {NIXL_WRITE, &src_xfer}, {NIXL_READ, &dst_xfer}};
+    for (const auto &[op, dram_xfer] : phases) {
+        print_segment_title (phase_title (op == NIXL_WRITE ? "Memory to File Transfer" :
+                                                             "File to Memory Transfer"));
+        nixlXferReqH *treq = nullptr;
+        nixl_status_t status =
+            agent.createXferReq (op, *dram_xfer, file_xfer, "POSIXStripeTester", treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Failed to create transfer request - status: "
+                      << nixlEnumStrings::statusStr (status) << std::endl;
+            return 1;
+        }
+
+        nixlTime::us_t start = nixlTime::getUs();
+        status = agent.postXferReq (treq);
+        while (status == NIXL_IN_PROG) {
+            status = agent.getXferStatus (treq);
+        }
+        nixlTime::us_t duration = nixlTime::getUs() - start;
+        agent.releaseXferReq (treq);
+        if (status != NIXL_SUCCESS) {
+            std::cerr << "Transfer failed - status: " << nixlEnumStrings::statusStr (status)
+                      << std::endl;
+            return 1;
+        }
+        std::cout << absl::StrFormat ("%.2f GB/s over %d files",
+                                      buffer_size / (double)gb_size / us_to_s (duration),
+                                      num_files)
+                  << std::endl;
+    }
+
+    print_segment_title (phase_title ("Validating read data"));
+    if (src != dst) {
+        std::cerr << "Read data doesn't match written data" << std::endl;
+        return 1;
+    }
+
+    std::vector<char> stripe (stripe_unit);
+    for (int i = 0; i < num_stripes; ++i) {
+        off_t member_offset = (i / num_files) * stripe_unit;
+        if (pread (files[i % num_files].fd, stripe.data(), stripe_unit, member_offset) !=
+                (ssize_t)stripe_unit ||
+            memcmp (stripe.data(), src.data() + i * stripe_unit, stripe_unit) != 0) {
+            std::cerr << "Stripe " << i << " not found in file " << i % num_files << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "Validation passed" << std::endl;
+
+    agent.deregisterMem (file_reg);
+    agent.deregisterMem (dst_reg);
+    agent.deregisterMem (src_reg);
+
+    return 0;
+}
+
 int
 main (int argc, char *argv[]) {
     if (page_size <= 0) {
@@ -754,9 +1343,9 @@ main (int argc, char *argv[]) {
     size_t transfer_size = default_transfer_size;
     std::string test_files_dir_path = default_test_files_dir_path;
     bool use_direct_io = false;
-    bool use_uring = false;
+    posix_api_t api = posix_api_t::AIO;
 
-    while ((opt = getopt (argc, argv, "n:s:d:DUh")) != -1) {
+    while ((opt = getopt (argc, argv, "n:s:d:DULPh")) != -1) {
         switch (opt) {
         case 'n':
             num_transfers = std::stoi (optarg);
@@ -771,12 +1360,18 @@ main (int argc, char *argv[]) {
             use_direct_io = true;
             break;
         case 'U':
-            use_uring = true;
+            api = posix_api_t::URING;
+            break;
+        case 'L':
+            api = posix_api_t::LINUX_AIO;
+            break;
+        case 'P':
+            api = posix_api_t::THREADPOOL;
             break;
         case 'h':
         default:
             std::cout << absl::StrFormat ("Usage: %s [-n num_transfers] [-s transfer_size] [-d "
-                                          "test_files_dir_path] [-D] [-U]",
+                                          "test_files_dir_path] [-D] [-U] [-L] [-P]",
                                           argv[0])
                       << std::endl;
             std::cout << absl::StrFormat (
@@ -794,6 +1389,10 @@ main (int argc, char *argv[]) {
                       << std::endl;
             std::cout << absl::StrFormat ("  -D Use O_DIRECT for file I/O") << std::endl;
             std::cout << absl::StrFormat ("  -U Use io_uring backend instead of AIO") << std::endl;
+            std::cout << absl::StrFormat ("  -L Use Linux kernel AIO (io_submit) backend instead of AIO")
+                      << std::endl;
+            std::cout << absl::StrFormat ("  -P Use thread pool pread/pwrite backend instead of AIO")
+                      << std::endl;
             std::cout << absl::StrFormat ("  -h Show this help message") << std::endl;
             return (opt == 'h') ? 0 : 1;
         }
@@ -806,7 +1405,7 @@ main (int argc, char *argv[]) {
         std::filesystem::absolute (test_files_dir_path_obj).string();
 
     int ret = read_write_test (
-        num_transfers, transfer_size, test_files_dir_path_abs_path, use_direct_io, use_uring);
+        num_transfers, transfer_size, test_files_dir_path_abs_path, use_direct_io, api);
 
     if (ret != 0) {
         std::cerr << "Read/Write Test failed" << std::endl;
@@ -816,11 +1415,51 @@ main (int argc, char *argv[]) {
     // Reset phase number for repost test
     phase_num = 1;
 
-    ret = test_posix_repost (test_files_dir_path_abs_path, use_uring);
+    ret = test_posix_repost (test_files_dir_path_abs_path, api);
     if (ret != 0) {
         std::cerr << "Repost Test failed" << std::endl;
         return 1;
     }
 
+    phase_num = 1;
+
+    ret = test_posix_sliding_window (test_files_dir_path_abs_path, api);
+    if (ret != 0) {
+        std::cerr << "Sliding Window Test failed" << std::endl;
+        return 1;
+    }
+
+    phase_num = 1;
+
+    ret = test_posix_coalesce (test_files_dir_path_abs_path, api);
+    if (ret != 0) {
+        std::cerr << "Coalesce Test failed" << std::endl;
+        return 1;
+    }
+
+    phase_num = 1;
+
+    ret = test_posix_direct_unaligned (test_files_dir_path_abs_path, api);
+    if (ret != 0) {
+        std::cerr << "Unaligned O_DIRECT Test failed" << std::endl;
+        return 1;
+    }
+
+    phase_num = 1;
+
+    ret = test_posix_prefetch (test_files_dir_path_abs_path, api);
+    if (ret != 0) {
+        std::cerr << "Prefetch Test failed" << std::endl;
+        return 1;
+    }
+
+    phase_num = 1;
+
+    ret = test_posix_striped (test_files_dir_path_abs_path, api);
+    if (ret != 0) {
+        std::cerr << "Striped File Test failed" << std::endl;
+        return 1;
+    }
+
     return 0;
 }
@@ -18,6 +18,9 @@
 #include <sstream>
 #include <string>
 #include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <thread>
 
 #include "ucx_backend.h"
 
@@ -671,6 +674,103 @@ void test_inter_agent_transfer(bool p_thread, bool reuse_hndl,
     //ucx2->disconnect(agent1);
 }
 
+// With busy polling, a transfer posted right after a completion is progressed
+// by the spinning thread without waking it up from poll()
+void test_busy_poll_pickup()
+{
+    std::cout << std::endl << std::endl;
+    std::cout << "****************************************************" << std::endl;
+    std::cout << "   Busy poll pickup test" << std::endl;
+    std::cout << "****************************************************" << std::endl;
+    std::cout << std::endl << std::endl;
+
+    nixlBackendInitParams init;
+    nixl_b_params_t       custom_params;
+    std::string           agent1("Agent1");
+    nixl_status_t         ret;
+
+    // Long enough for the second transfer to be posted within the window even on a
+    // loaded host, the thread stops spinning as soon as the engine is released
+    custom_params["ucx_pt_busy_poll_us"] = "10000000";
+    init.enableProgTh = true;
+    init.pthrDelay    = 100;
+    init.localAgent   = agent1;
+    init.customParams = &custom_params;
+    init.type         = "UCX";
+
+    nixlUcxEngine *ucx = new nixlUcxEngine (&init);
+    assert(!ucx->getInitErr());
+
+    std::string conn_info;
+    ret = ucx->getConnInfo(conn_info);
+    assert(ret == NIXL_SUCCESS);
+    ret = ucx->loadRemoteConnInfo(agent1, conn_info);
+    assert(ret == NIXL_SUCCESS);
+
+    int desc_cnt = 16;
+    size_t desc_size = 1 * 1024 * 1024;
+    size_t len = desc_cnt * desc_size;
+
+    void *addr1, *addr2;
+    nixlBackendMD *lmd1, *lmd2, *rmd2;
+    allocateAndRegister(ucx, 0, DRAM_SEG, addr1, len, lmd1);
+    allocateAndRegister(ucx, 0, DRAM_SEG, addr2, len, lmd2);
+    ret = ucx->loadLocalMD(lmd2, rmd2);
+    assert(ret == NIXL_SUCCESS);
+
+    nixl_meta_dlist_t req_src_descs (DRAM_SEG);
+    populateDescs(req_src_descs, 0, addr1, desc_cnt, desc_size, lmd1);
+    nixl_meta_dlist_t req_dst_descs (DRAM_SEG);
+    populateDescs(req_dst_descs, 0, addr2, desc_cnt, desc_size, rmd2);
+
+    // Reads the pattern from addr2 into addr1. The request is left to the progress
+    // thread, it's only checked once the data landed, so the caller doesn't progress
+    // the worker itself. Returns false if postXfer completed the transfer.
+    auto transfer = [&](uint8_t pattern) {
+        doMemset(DRAM_SEG, 0, addr1, 0, len);
+        doMemset(DRAM_SEG, 0, addr2, pattern, len);
+
+        nixlBackendReqH *handle = nullptr;
+        ret = ucx->prepXfer(NIXL_READ, req_src_descs, req_dst_descs, agent1, handle);
+        assert(ret == NIXL_SUCCESS);
+        ret = ucx->postXfer(NIXL_READ, req_src_descs, req_dst_descs, agent1, handle);
+        assert(ret == NIXL_SUCCESS || ret == NIXL_IN_PROG);
+        bool in_prog = (ret == NIXL_IN_PROG);
+
+        auto landed = [&]() {
+            return std::all_of((uint8_t*) addr1, (uint8_t*) addr1 + len,
+                               [pattern](uint8_t byte) { return byte == pattern; });
+        };
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (in_prog && !landed() && (std::chrono::steady_clock::now() < deadline))
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        assert(landed());
+
+        while (ret == NIXL_IN_PROG)
+            ret = ucx->checkXfer(handle);
+        assert(ret == NIXL_SUCCESS);
+        ucx->releaseReqH(handle);
+        return in_prog;
+    };
+
+    // The progress thread completes the first transfer, and spins after it
+    if (!transfer(0xbb)) {
+        cout << "\t\tWARNING: Transfer request completed immediately - busy poll pickup not tested"
+             << endl;
+    } else {
+        uint64_t wakeups = ucx->getProgressWakeups();
+        transfer(0xcc);
+        assert(ucx->getProgressWakeups() == wakeups);
+        cout << "\t\tPicked up without a wakeup: OK" << endl;
+    }
+
+    ucx->unloadMD(rmd2);
+    deallocateAndDeregister(ucx, 0, DRAM_SEG, addr1, lmd1);
+    deallocateAndDeregister(ucx, 0, DRAM_SEG, addr2, lmd2);
+    ucx->disconnect(agent1);
+    releaseEngine(ucx);
+}
+
 int main()
 {
     bool thread_on[2] = {false, true};
@@ -744,6 +844,8 @@ int main()
 	}
 #endif
 
+    test_busy_poll_pickup();
+
     // Deallocate UCX engines
     for(int i = 0; i < 2; i++) {
         for(int j = 0; j < 2; j++) {
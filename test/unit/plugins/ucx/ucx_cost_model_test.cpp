@@ -0,0 +1,86 @@
+/*
+ * SPDX-FileCopyrightText: Copyright (c) 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <iostream>
+#include <cstdlib>
+
+#include "ucx_cost_model.h"
+
+using namespace std::chrono;
+
+// Synthetic link: 2us per descriptor and 10 GB/s, i.e. 1us per 10KB
+static microseconds linkCost(size_t bytes, size_t descs) {
+    return microseconds(2 * descs + bytes / 10000);
+}
+
+static bool near(microseconds a, microseconds b, long tolerance) {
+    return std::labs(a.count() - b.count()) <= tolerance;
+}
+
+// Checked explicitly, so that release builds fail too
+static bool check(bool ok, const char *what) {
+    if (!ok)
+        std::cerr << "UCX cost model test failed: " << what << std::endl;
+    return ok;
+}
+
+int main() {
+    nixlUcxCostModel model(0.95);
+    microseconds duration, err_margin;
+
+    // Nothing learned yet
+    if (!check(!model.estimate("peer", 1 << 20, 1, duration, err_margin),
+               "estimate before any sample"))
+        return 1;
+
+    // Exact samples across sizes and descriptor counts
+    for (int i = 0; i < 100; i++) {
+        size_t bytes = (size_t)(1 + (i % 8)) << 20;
+        size_t descs = 1 + (i % 5);
+        model.record("peer", bytes, descs, linkCost(bytes, descs));
+    }
+
+    if (!check(model.estimate("peer", 4 << 20, 3, duration, err_margin),
+               "estimate after exact samples") ||
+        !check(near(duration, linkCost(4 << 20, 3), 2), "duration of exact samples") ||
+        !check(err_margin.count() <= 1, "error margin of exact samples"))
+        return 1;
+
+    // Unseen size class falls back to the fit over all transfers to the peer
+    if (!check(model.estimate("peer", 64 << 20, 1, duration, err_margin),
+               "estimate of an unseen size class") ||
+        !check(near(duration, linkCost(64 << 20, 1), 16), "duration of an unseen size class"))
+        return 1;
+
+    // Other peers are learned separately
+    if (!check(!model.estimate("other", 4 << 20, 3, duration, err_margin),
+               "estimate for a peer without samples"))
+        return 1;
+
+    // Congestion halves the bandwidth, recent samples take over
+    for (int i = 0; i < 200; i++) {
+        size_t bytes = (size_t)(1 + (i % 8)) << 20;
+        model.record("peer", bytes, 1, linkCost(2 * bytes, 1));
+    }
+
+    if (!check(model.estimate("peer", 4 << 20, 1, duration, err_margin),
+               "estimate after congestion") ||
+        !check(near(duration, linkCost(8 << 20, 1), 8), "duration after congestion"))
+        return 1;
+
+    std::cout << "UCX cost model test passed" << std::endl;
+    return 0;
+}
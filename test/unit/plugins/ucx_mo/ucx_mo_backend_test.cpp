@@ -71,13 +71,18 @@ std::string memType2Str(nixl_mem_t mem_type)
     }
 }
 
-nixlBackendEngine *createEngine(std::string name, uint32_t ndev, bool p_thread)
+nixlBackendEngine *createEngine(std::string name, uint32_t ndev, bool p_thread,
+                                bool parallel = false)
 {
     nixlBackendEngine     *ucx_mo;
     nixlBackendInitParams init;
     nixl_b_params_t       custom_params;
 
     custom_params["num_ucx_engines"] = std::to_string(ndev);
+    if (parallel) {
+        custom_params["numa_aware"] = "true";
+        custom_params["num_post_threads"] = "4";
+    }
     init.enableProgTh = p_thread;
     init.pthrDelay    = 100;
     init.localAgent   = name;
@@ -622,4 +627,20 @@ int ndevices = NUM_WORKERS;
             releaseEngine(ucx[i][j]);
         }
     }
+
+    // NUMA aware routing and parallel post to the engines
+    nixlBackendEngine *par_ucx[2];
+    for(int j = 0; j < 2; j++) {
+        std::stringstream s;
+        s << "Agent" << (j + 1);
+        par_ucx[j] = createEngine(s.str(), ndevices, false, true);
+    }
+
+    test_agent_transfer(false,
+                        par_ucx[0], DRAM_SEG, ndevices, dev_distr_rr,
+                        par_ucx[1], DRAM_SEG, ndevices, dev_distr_blk);
+
+    for(int j = 0; j < 2; j++) {
+        releaseEngine(par_ucx[j]);
+    }
 }